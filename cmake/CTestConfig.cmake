@@ -102,6 +102,11 @@ add_precice_test(
   ARGUMENTS "--run_test=IOTests"
   TIMEOUT ${PRECICE_TEST_TIMEOUT_SHORT}
   )
+add_precice_test(
+  NAME logging
+  ARGUMENTS "--run_test=LoggingTests"
+  TIMEOUT ${PRECICE_TEST_TIMEOUT_SHORT}
+  )
 add_precice_test(
   NAME m2n
   ARGUMENTS "--run_test=M2NTests:\!M2NTests/MPIPortsCommunication"
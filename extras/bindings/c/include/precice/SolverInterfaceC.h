@@ -413,6 +413,30 @@ void precicec_readScalarData(
     int     valueIndex,
     double *dataValue);
 
+/**
+ * @brief See precice::SolverInterface::writeAllData().
+ */
+void precicec_writeAllData(
+    int           dataID,
+    const double *values);
+
+/**
+ * @brief See precice::SolverInterface::readAllData().
+ */
+void precicec_readAllData(
+    int     dataID,
+    double *values);
+
+/**
+ * @brief See precice::SolverInterface::getWriteDataBuffer().
+ */
+double *precicec_getWriteDataBuffer(int dataID);
+
+/**
+ * @brief See precice::SolverInterface::getReadDataBuffer().
+ */
+const double *precicec_getReadDataBuffer(int dataID);
+
 /** 
  * @brief Returns information on the version of preCICE.
  *
@@ -326,6 +326,34 @@ void precicec_readScalarData(
   interface->readScalarData(dataID, valueIndex, *dataValue);
 }
 
+void precicec_writeAllData(
+    int           dataID,
+    const double *values)
+{
+  PRECICE_ASSERT(interface != nullptr);
+  interface->writeAllData(dataID, values);
+}
+
+void precicec_readAllData(
+    int     dataID,
+    double *values)
+{
+  PRECICE_ASSERT(interface != nullptr);
+  interface->readAllData(dataID, values);
+}
+
+double *precicec_getWriteDataBuffer(int dataID)
+{
+  PRECICE_ASSERT(interface != nullptr);
+  return interface->getWriteDataBuffer(dataID);
+}
+
+const double *precicec_getReadDataBuffer(int dataID)
+{
+  PRECICE_ASSERT(interface != nullptr);
+  return interface->getReadDataBuffer(dataID);
+}
+
 const char *precicec_getVersionInformation()
 {
   return {precice::versionInformation};
@@ -7,6 +7,7 @@
 #include "mesh/Vertex.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/Event.hpp"
+#include "utils/EventUtils.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/MasterSlave.hpp"
 
@@ -36,7 +37,8 @@ BaseQNAcceleration::BaseQNAcceleration(
       _qrV(filter),
       _filter(filter),
       _singularityLimit(singularityLimit),
-      _infostringstream(std::ostringstream::ate)
+      _infostringstream(std::ostringstream::ate),
+      _updateEvent(utils::EventRegistry::instance().getEventID("cpl.computeQuasiNewtonUpdate"))
 {
   PRECICE_CHECK((_initialRelaxation > 0.0) && (_initialRelaxation <= 1.0),
                 "Initial relaxation factor for QN acceleration has to "
@@ -297,7 +299,7 @@ void BaseQNAcceleration::performAcceleration(
 {
   PRECICE_TRACE(_dataIDs.size(), cplData.size());
 
-  utils::Event e("cpl.computeQuasiNewtonUpdate", precice::syncMode);
+  utils::Event e(_updateEvent, precice::syncMode);
 
   PRECICE_ASSERT(_oldResiduals.size() == _oldXTilde.size(), _oldResiduals.size(), _oldXTilde.size());
   PRECICE_ASSERT(_values.size() == _oldXTilde.size(), _values.size(), _oldXTilde.size());
@@ -656,6 +658,12 @@ void BaseQNAcceleration::importState(
 {
 }
 
+void BaseQNAcceleration::setOrthogonalization(
+    impl::QRFactorization::Orthogonalization orthogonalization)
+{
+  _qrV.setOrthogonalization(orthogonalization);
+}
+
 int BaseQNAcceleration::getDeletedColumns()
 {
   return _nbDelCols;
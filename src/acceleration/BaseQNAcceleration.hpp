@@ -133,6 +133,9 @@ public:
     */
   virtual void importState(io::TXTReader &reader);
 
+  /// Sets the method used to orthogonalize new columns of the least-squares system.
+  void setOrthogonalization(impl::QRFactorization::Orthogonalization orthogonalization);
+
   // delete this:
   virtual int getDeletedColumns();
 
@@ -230,6 +233,9 @@ protected:
   std::ostringstream _infostringstream;
   std::fstream       _infostream;
 
+  /// ID of the event of performAcceleration()
+  int _updateEvent;
+
   /** @brief: computes number of cols in least squares system, i.e, number of cols in
     *  _matrixV, _matrixW, _qrV, etc..
     *	 This is necessary only for master-slave mode, when some procs do not have
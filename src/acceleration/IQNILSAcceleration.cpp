@@ -135,8 +135,8 @@ void IQNILSAcceleration::computeQNUpdate(Acceleration::DataMap &cplData, Eigen::
 
   // for master-slave mode and procs with no vertices,
   // qrV.cols() = getLSSystemCols() and _qrV.rows() = 0
-  auto Q = _qrV.matrixQ();
-  auto R = _qrV.matrixR();
+  const Eigen::MatrixXd &Q = _qrV.matrixQ();
+  const Eigen::MatrixXd &R = _qrV.matrixR();
 
   if (!_hasNodesOnInterface) {
     PRECICE_ASSERT(_qrV.cols() == getLSSystemCols(), _qrV.cols(), getLSSystemCols());
@@ -149,10 +149,7 @@ void IQNILSAcceleration::computeQNUpdate(Acceleration::DataMap &cplData, Eigen::
 
   // need to scale the residual to compensate for the scaling in c = R^-1 * Q^T * P^-1 * residual'
   // it is also possible to apply the inverse scaling weights from the right to the vector c
-  _preconditioner->apply(_residuals);
-  _local_b = Q.transpose() * _residuals;
-  _preconditioner->revert(_residuals);
-  _local_b *= -1.0; // = -Qr
+  _local_b.noalias() = -(Q.transpose() * _preconditioner->getWeights().cwiseProduct(_residuals)); // = -Qr
 
   PRECICE_ASSERT(c.size() == 0, c.size());
   // reserve memory for c
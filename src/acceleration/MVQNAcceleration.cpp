@@ -287,8 +287,8 @@ void MVQNAcceleration::pseudoInverse(
    *   computation of pseudo inverse matrix Z = (V^TV)^-1 * V^T as solution
    *   to the equation R*z = Q^T(i) for all columns i,  via back substitution.
    */
-  auto Q = _qrV.matrixQ();
-  auto R = _qrV.matrixR();
+  const Eigen::MatrixXd &Q = _qrV.matrixQ();
+  const Eigen::MatrixXd &R = _qrV.matrixR();
 
   PRECICE_ASSERT(pseudoInverse.rows() == _qrV.cols(), pseudoInverse.rows(), _qrV.cols());
   PRECICE_ASSERT(pseudoInverse.cols() == _qrV.rows(), pseudoInverse.cols(), _qrV.rows());
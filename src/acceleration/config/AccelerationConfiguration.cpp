@@ -34,6 +34,7 @@ AccelerationConfiguration::AccelerationConfiguration(
       TAG_ESTIMATEJACOBIAN("estimate-jacobian"),
       TAG_PRECONDITIONER("preconditioner"),
       TAG_IMVJRESTART("imvj-restart-mode"),
+      TAG_ORTHOGONALIZATION("orthogonalization"),
       ATTR_NAME("name"),
       ATTR_MESH("mesh"),
       ATTR_SCALING("scaling"),
@@ -64,6 +65,8 @@ AccelerationConfiguration::AccelerationConfiguration(
       VALUE_SVD_RESTART("RS-SVD"),
       VALUE_SLIDE_RESTART("RS-SLIDE"),
       VALUE_NO_RESTART("no-restart"),
+      VALUE_MODIFIED_GRAM_SCHMIDT("modified-gram-schmidt"),
+      VALUE_CLASSICAL_GRAM_SCHMIDT("classical-gram-schmidt"),
       _meshConfig(meshConfig),
       _acceleration(),
       _coarseModelOptimizationConfig(),
@@ -202,6 +205,15 @@ void AccelerationConfiguration::xmlTagCallback(
       PRECICE_ASSERT(false);
     }
     _config.singularityLimit = callingTag.getDoubleAttributeValue(ATTR_SINGULARITYLIMIT);
+  } else if (callingTag.getName() == TAG_ORTHOGONALIZATION) {
+    auto f = callingTag.getStringAttributeValue(ATTR_TYPE);
+    if (f == VALUE_MODIFIED_GRAM_SCHMIDT) {
+      _config.orthogonalization = QRFactorization::MODIFIED_GRAM_SCHMIDT;
+    } else if (f == VALUE_CLASSICAL_GRAM_SCHMIDT) {
+      _config.orthogonalization = QRFactorization::CLASSICAL_GRAM_SCHMIDT;
+    } else {
+      PRECICE_ASSERT(false);
+    }
   } else if (callingTag.getName() == TAG_ESTIMATEJACOBIAN) {
     if (_config.type == VALUE_ManifoldMapping)
       _config.estimateJacobian = callingTag.getBooleanAttributeValue(ATTR_VALUE);
@@ -342,6 +354,11 @@ void AccelerationConfiguration::xmlEndTagCallback(
     } else {
       PRECICE_ASSERT(false);
     }
+
+    auto qnAcceleration = std::dynamic_pointer_cast<BaseQNAcceleration>(_acceleration);
+    if (qnAcceleration) {
+      qnAcceleration->setOrthogonalization(static_cast<QRFactorization::Orthogonalization>(_config.orthogonalization));
+    }
   }
 }
 
@@ -422,6 +439,18 @@ void AccelerationConfiguration::addTypeSpecificSubtags(
                                "are filtered out.");
     tag.addSubtag(tagFilter);
 
+    XMLTag tagOrthogonalization(*this, TAG_ORTHOGONALIZATION, XMLTag::OCCUR_NOT_OR_ONCE);
+    auto   attrOrthogonalizationType = XMLAttribute<std::string>(ATTR_TYPE)
+                                         .setOptions({VALUE_MODIFIED_GRAM_SCHMIDT,
+                                                      VALUE_CLASSICAL_GRAM_SCHMIDT});
+    tagOrthogonalization.addAttribute(attrOrthogonalizationType);
+    tagOrthogonalization.setDocumentation("Method used to orthogonalize new columns of the least-squares system "
+                                          "in the QR-decomposition. Possible methods:\n"
+                                          "  modified-gram-schmidt: one global reduction per existing column (default)\n"
+                                          "  classical-gram-schmidt: one global reduction per pass, with reorthogonalization "
+                                          "if needed. This avoids most of the communication in parallel runs.");
+    tag.addSubtag(tagOrthogonalization);
+
     XMLTag tagPreconditioner(*this, TAG_PRECONDITIONER, XMLTag::OCCUR_NOT_OR_ONCE);
     auto   attrPreconditionerType = XMLAttribute<std::string>(ATTR_TYPE)
                                       .setDocumentation(
@@ -516,6 +545,18 @@ void AccelerationConfiguration::addTypeSpecificSubtags(
                                "are filtered out.");
     tag.addSubtag(tagFilter);
 
+    XMLTag tagOrthogonalization(*this, TAG_ORTHOGONALIZATION, XMLTag::OCCUR_NOT_OR_ONCE);
+    auto   attrOrthogonalizationType = XMLAttribute<std::string>(ATTR_TYPE)
+                                         .setOptions({VALUE_MODIFIED_GRAM_SCHMIDT,
+                                                      VALUE_CLASSICAL_GRAM_SCHMIDT});
+    tagOrthogonalization.addAttribute(attrOrthogonalizationType);
+    tagOrthogonalization.setDocumentation("Method used to orthogonalize new columns of the least-squares system "
+                                          "in the QR-decomposition. Possible methods:\n"
+                                          "  modified-gram-schmidt: one global reduction per existing column (default)\n"
+                                          "  classical-gram-schmidt: one global reduction per pass, with reorthogonalization "
+                                          "if needed. This avoids most of the communication in parallel runs.");
+    tag.addSubtag(tagOrthogonalization);
+
     XMLTag tagPreconditioner(*this, TAG_PRECONDITIONER, XMLTag::OCCUR_NOT_OR_ONCE);
     auto   attrPreconditionerType = XMLAttribute<std::string>(ATTR_TYPE)
                                       .setOptions({VALUE_CONSTANT_PRECONDITIONER,
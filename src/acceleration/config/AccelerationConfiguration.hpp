@@ -3,6 +3,7 @@
 #include "acceleration/Acceleration.hpp"
 #include "acceleration/MVQNAcceleration.hpp"
 #include "acceleration/SharedPointer.hpp"
+#include "acceleration/impl/QRFactorization.hpp"
 #include "acceleration/impl/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -59,6 +60,7 @@ private:
   const std::string TAG_ESTIMATEJACOBIAN;
   const std::string TAG_PRECONDITIONER;
   const std::string TAG_IMVJRESTART;
+  const std::string TAG_ORTHOGONALIZATION;
 
   const std::string ATTR_NAME;
   const std::string ATTR_MESH;
@@ -91,6 +93,8 @@ private:
   const std::string VALUE_SVD_RESTART;
   const std::string VALUE_SLIDE_RESTART;
   const std::string VALUE_NO_RESTART;
+  const std::string VALUE_MODIFIED_GRAM_SCHMIDT;
+  const std::string VALUE_CLASSICAL_GRAM_SCHMIDT;
 
   const mesh::PtrMeshConfiguration _meshConfig;
 
@@ -116,6 +120,7 @@ private:
     int                   timeWindowsReused          = 0;
     int                   filter                     = Acceleration::NOFILTER;
     int                   imvjRestartType            = 0;
+    int                   orthogonalization          = impl::QRFactorization::MODIFIED_GRAM_SCHMIDT;
     int                   imvjChunkSize              = 0;
     int                   imvjRSLS_reusedTimeWindows = 0;
     int                   precond_nbNonConstTSteps   = -1;
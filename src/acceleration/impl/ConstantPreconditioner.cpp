@@ -23,10 +23,8 @@ void ConstantPreconditioner::initialize(std::vector<size_t> &svs)
 
   int offset = 0;
   for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-    for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-      _weights[i + offset]    = 1.0 / _factors[k];
-      _invWeights[i + offset] = _factors[k];
-    }
+    _weights.segment(offset, _subVectorSizes[k]).setConstant(1.0 / _factors[k]);
+    _invWeights.segment(offset, _subVectorSizes[k]).setConstant(_factors[k]);
     offset += _subVectorSizes[k];
   }
 }
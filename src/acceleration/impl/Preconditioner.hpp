@@ -37,7 +37,7 @@ public:
   {
     PRECICE_TRACE();
 
-    PRECICE_ASSERT(_weights.empty());
+    PRECICE_ASSERT(_weights.size() == 0);
     _subVectorSizes = svs;
 
     size_t N = 0;
@@ -45,8 +45,8 @@ public:
       N += elem;
     }
     // cannot do this already in the constructor as the size is unknown at that point
-    _weights.resize(N, 1.0);
-    _invWeights.resize(N, 1.0);
+    _weights    = Eigen::VectorXd::Ones(N);
+    _invWeights = Eigen::VectorXd::Ones(N);
   }
 
   /**
@@ -57,19 +57,11 @@ public:
   {
     PRECICE_TRACE();
     if (transpose) {
-      PRECICE_ASSERT(M.cols() == (int) _weights.size(), M.cols(), _weights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _weights[i];
-        }
-      }
+      PRECICE_ASSERT(M.cols() == _weights.size(), M.cols(), _weights.size());
+      M = M * _weights.asDiagonal();
     } else {
-      PRECICE_ASSERT(M.rows() == (int) _weights.size(), M.rows(), (int) _weights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _weights[j];
-        }
-      }
+      PRECICE_ASSERT(M.rows() == _weights.size(), M.rows(), _weights.size());
+      M = _weights.asDiagonal() * M;
     }
   }
 
@@ -82,19 +74,11 @@ public:
     PRECICE_TRACE();
     //PRECICE_ASSERT(_needsGlobalWeights);
     if (transpose) {
-      PRECICE_ASSERT(M.cols() == (int) _invWeights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _invWeights[i];
-        }
-      }
+      PRECICE_ASSERT(M.cols() == _invWeights.size());
+      M = M * _invWeights.asDiagonal();
     } else {
-      PRECICE_ASSERT(M.rows() == (int) _invWeights.size(), M.rows(), (int) _invWeights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _invWeights[j];
-        }
-      }
+      PRECICE_ASSERT(M.rows() == _invWeights.size(), M.rows(), _invWeights.size());
+      M = _invWeights.asDiagonal() * M;
     }
   }
 
@@ -102,14 +86,10 @@ public:
   void apply(Eigen::MatrixXd &M)
   {
     PRECICE_TRACE();
-    PRECICE_ASSERT(M.rows() == (int) _weights.size(), M.rows(), (int) _weights.size());
+    PRECICE_ASSERT(M.rows() == _weights.size(), M.rows(), _weights.size());
 
     // scale matrix M
-    for (int i = 0; i < M.cols(); i++) {
-      for (int j = 0; j < M.rows(); j++) {
-        M(j, i) *= _weights[j];
-      }
-    }
+    M = _weights.asDiagonal() * M;
   }
 
   /// To transform physical values to balanced values. Vector version
@@ -117,12 +97,10 @@ public:
   {
     PRECICE_TRACE();
 
-    PRECICE_ASSERT(v.size() == (int) _weights.size());
+    PRECICE_ASSERT(v.size() == _weights.size());
 
     // scale residual
-    for (int j = 0; j < v.size(); j++) {
-      v[j] *= _weights[j];
-    }
+    v.array() *= _weights.array();
   }
 
   /// To transform balanced values back to physical values. Matrix version
@@ -130,14 +108,10 @@ public:
   {
     PRECICE_TRACE();
 
-    PRECICE_ASSERT(M.rows() == (int) _weights.size());
+    PRECICE_ASSERT(M.rows() == _weights.size());
 
     // scale matrix M
-    for (int i = 0; i < M.cols(); i++) {
-      for (int j = 0; j < M.rows(); j++) {
-        M(j, i) *= _invWeights[j];
-      }
-    }
+    M = _invWeights.asDiagonal() * M;
   }
 
   /// To transform balanced values back to physical values. Vector version
@@ -145,12 +119,10 @@ public:
   {
     PRECICE_TRACE();
 
-    PRECICE_ASSERT(v.size() == (int) _weights.size());
+    PRECICE_ASSERT(v.size() == _weights.size());
 
     // scale residual
-    for (int j = 0; j < v.size(); j++) {
-      v[j] *= _invWeights[j];
-    }
+    v.array() *= _invWeights.array();
   }
 
   /**
@@ -190,7 +162,7 @@ public:
     _requireNewQR = false;
   }
 
-  std::vector<double> &getWeights()
+  const Eigen::VectorXd &getWeights() const
   {
     return _weights;
   }
@@ -202,10 +174,10 @@ public:
 
 protected:
   /// Weights used to scale the matrix V and the residual
-  std::vector<double> _weights;
+  Eigen::VectorXd _weights;
 
   /// Inverse weights (for efficiency reasons)
-  std::vector<double> _invWeights;
+  Eigen::VectorXd _invWeights;
 
   /// Sizes of each sub-vector, i.e. each coupling data
   std::vector<size_t> _subVectorSizes;
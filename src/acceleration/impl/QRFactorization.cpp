@@ -311,6 +311,10 @@ int QRFactorization::orthogonalize(
 {
   PRECICE_TRACE();
 
+  if (_orthogonalization == CLASSICAL_GRAM_SCHMIDT) {
+    return orthogonalizeClassical(v, r, rho, colNum);
+  }
+
   if (not utils::MasterSlave::isMaster() && not utils::MasterSlave::isSlave()) {
     PRECICE_ASSERT(_globalRows == _rows, _globalRows, _rows);
   } else {
@@ -608,6 +612,89 @@ int QRFactorization::orthogonalize_stable(
   return k;
 }
 
+/**
+ * @short classical Gram-Schmidt variant of orthogonalize(). It reduces the Fourier
+ *   coefficients and the norm of v over all ranks in a single allreduceSum per
+ *   (re-)orthogonalization sweep instead of one reduction per column of Q.
+ *
+ *   @return Returns the number of sweeps needed, or -1 if v could not be
+ *   orthogonalized within 4 sweeps.
+ */
+int QRFactorization::orthogonalizeClassical(
+    Eigen::VectorXd &v,
+    Eigen::VectorXd &r,
+    double &         rho,
+    int              colNum)
+{
+  PRECICE_TRACE();
+
+  // treat the special case m=n, see orthogonalize()
+  if (_globalRows == colNum) {
+    PRECICE_WARN("The least-squares system matrix is quadratic, i.e., the new column cannot be orthogonalized (and thus inserted) to the LS-system.\nOld columns need to be removed.");
+    v   = Eigen::VectorXd::Zero(_rows);
+    rho = 0.;
+    return 1;
+  }
+
+  const auto      Q = _Q.leftCols(colNum);
+  Eigen::VectorXd localSums(colNum + 1);
+  Eigen::VectorXd sums(colNum + 1);
+  Eigen::VectorXd s(colNum);
+  r = Eigen::VectorXd::Zero(_cols);
+
+  // computes the fourier coefficients Q^T v and ||v||^2 and sums them up over all ranks
+  // Q is still empty when the first column is inserted
+  auto reduce = [&]() {
+    if (colNum > 0)
+      localSums.head(colNum).noalias() = Q.transpose() * v;
+    localSums(colNum) = v.squaredNorm();
+    utils::MasterSlave::allreduceSum(localSums.data(), sums.data(), colNum + 1);
+  };
+
+  reduce();
+  bool   null = false;
+  double rho0 = std::sqrt(sums(colNum));
+  double rho1 = 0.;
+  int    k    = 0;
+  while (true) {
+    // subtract projections from v, using the coefficients of the last reduction
+    s = sums.head(colNum);
+    if (colNum > 0)
+      v.noalias() -= Q * s;
+    r.head(colNum) += s;
+    k++;
+
+    // rho1 = norm of orthogonalized new column v_tilde (though not normalized),
+    // reduced together with the coefficients of a possible reorthogonalization
+    reduce();
+    rho1 = std::sqrt(sums(colNum));
+
+    // take correct action if v_orth is null
+    if (rho1 <= std::numeric_limits<double>::min()) {
+      PRECICE_DEBUG("The norm of v_orthogonal is almost zero, i.e., failed to orthogonalize column v; discard.");
+      null = true;
+      rho1 = 1;
+      break;
+    }
+
+    // re-orthogonalize if: ||v_orth|| / ||v|| <= 1/theta, see orthogonalize()
+    if (rho1 * _theta > rho0 + _omega * s.norm()) {
+      break;
+    }
+    if (k >= 4) {
+      PRECICE_WARN("Matrix Q is not sufficiently orthogonal. Failed to rorthogonalize new column after 4 iterations. New column will be discarded. The least-squares system is very bad conditioned and the quasi-Newton will most probably fail to converge.");
+      return -1;
+    }
+    rho0 = rho1;
+  }
+
+  // normalize v
+  v /= rho1;
+  rho       = null ? 0 : rho1;
+  r(colNum) = rho;
+  return k;
+}
+
 /**
  * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
  */
@@ -775,6 +862,11 @@ void QRFactorization::setFilter(int filter)
   _filter = filter;
 }
 
+void QRFactorization::setOrthogonalization(Orthogonalization orthogonalization)
+{
+  _orthogonalization = orthogonalization;
+}
+
 } // namespace impl
 } // namespace acceleration
 } // namespace precice
@@ -20,6 +20,14 @@ namespace impl {
  */
 class QRFactorization {
 public:
+  /// Methods to orthogonalize a new column to the columns of Q.
+  enum Orthogonalization {
+    /// Modified Gram-Schmidt, requires one global reduction per column of Q.
+    MODIFIED_GRAM_SCHMIDT,
+    /// Classical Gram-Schmidt with reorthogonalization, requires one global reduction per pass.
+    CLASSICAL_GRAM_SCHMIDT
+  };
+
   /**
    * @brief Constructor.
    * @param theta - singularity limit for reothogonalization ||v_orth|| / ||v|| <= 1/theta
@@ -156,6 +164,9 @@ public:
   // @brief sets the filtering technique to maintain good conditioning of the least squares system
   void setFilter(int filter);
 
+  // @brief sets the method to orthogonalize inserted columns
+  void setOrthogonalization(Orthogonalization orthogonalization);
+
 private:
   struct givensRot {
     int    i, j;
@@ -189,6 +200,17 @@ private:
    */
   int orthogonalize(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
 
+  /**
+   * @short Variant of orthogonalize() using classical Gram-Schmidt.
+   *
+   *   All Fourier coefficients Q^T v of one pass are computed locally at once and
+   *   reduced over all ranks together with the squared norm of v. The norm of the
+   *   orthogonalized v is reduced together with the coefficients of the next pass.
+   *   Hence, inserting a column requires two global reductions, plus one for every
+   *   reorthogonalization, instead of one per column of Q and pass.
+   */
+  int orthogonalizeClassical(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
+
   /**
   * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
   */
@@ -213,6 +235,8 @@ private:
   double _theta;
   double _sigma;
 
+  Orthogonalization _orthogonalization = MODIFIED_GRAM_SCHMIDT;
+
   // @brief optional infostream that writes information to file
   std::fstream *_infostream;
   bool          _fstream_set;
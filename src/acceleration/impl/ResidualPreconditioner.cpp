@@ -30,10 +30,8 @@ void ResidualPreconditioner::_update_(bool                   timestepComplete,
 
     offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        _weights[i + offset]    = 1.0 / norms[k];
-        _invWeights[i + offset] = norms[k];
-      }
+      _weights.segment(offset, _subVectorSizes[k]).setConstant(1.0 / norms[k]);
+      _invWeights.segment(offset, _subVectorSizes[k]).setConstant(norms[k]);
       offset += _subVectorSizes[k];
     }
 
@@ -49,10 +49,8 @@ void ResidualSumPreconditioner::_update_(bool                   timestepComplete
 
     offset = 0;
     for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        _weights[i + offset]    = 1 / _residualSum[k];
-        _invWeights[i + offset] = _residualSum[k];
-      }
+      _weights.segment(offset, _subVectorSizes[k]).setConstant(1 / _residualSum[k]);
+      _invWeights.segment(offset, _subVectorSizes[k]).setConstant(_residualSum[k]);
       offset += _subVectorSizes[k];
     }
 
@@ -218,6 +218,39 @@ BOOST_AUTO_TEST_CASE(testConstPreconditioner)
   BOOST_TEST(testing::equals(_data, backup));
 }
 
+BOOST_AUTO_TEST_CASE(testMatrixScaling)
+{
+  std::vector<size_t> svs{1, 2};
+  ConstantPreconditioner precond({2.0, 4.0});
+  precond.initialize(svs);
+  BOOST_TEST(testing::equals(precond.getWeights(), Eigen::Vector3d(0.5, 0.25, 0.25)));
+
+  Eigen::MatrixXd M(3, 3);
+  M << 1.0, 2.0, 3.0,
+      4.0, 5.0, 6.0,
+      7.0, 8.0, 9.0;
+  const Eigen::MatrixXd backup = M;
+
+  // scales the rows
+  precond.apply(M);
+  Eigen::MatrixXd expected(3, 3);
+  expected << 0.5, 1.0, 1.5,
+      1.0, 1.25, 1.5,
+      1.75, 2.0, 2.25;
+  BOOST_TEST(testing::equals(M, expected));
+  precond.revert(M);
+  BOOST_TEST(testing::equals(M, backup));
+
+  // scales the columns
+  precond.apply(M, true);
+  expected << 0.5, 0.5, 0.75,
+      2.0, 1.25, 1.5,
+      3.5, 2.0, 2.25;
+  BOOST_TEST(testing::equals(M, expected));
+  precond.revert(M, true);
+  BOOST_TEST(testing::equals(M, backup));
+}
+
 BOOST_AUTO_TEST_CASE(testMultilpleMeshes)
 {
   std::vector<size_t> svs;
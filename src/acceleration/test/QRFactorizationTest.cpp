@@ -148,4 +148,37 @@ BOOST_AUTO_TEST_CASE(testQRFactorization)
   testQRequalsA(qr_1.matrixQ(), qr_1.matrixR(), A);
 }
 
+BOOST_AUTO_TEST_CASE(testQRFactorizationClassicalGramSchmidt)
+{
+  int             m = 6, n = 8;
+  int             filter = BaseQNAcceleration::QR1FILTER;
+  Eigen::MatrixXd A(n, m);
+
+  // Set values according to Hilbert matrix, which requires reorthogonalization.
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+  }
+
+  QRFactorization qr(filter);
+  qr.setOrthogonalization(QRFactorization::CLASSICAL_GRAM_SCHMIDT);
+  qr.setGlobalRows(n);
+  for (int j = 0; j < m; j++) {
+    BOOST_TEST(qr.insertColumn(j, A.col(j)));
+  }
+  BOOST_TEST(qr.cols() == m);
+
+  testQTQequalsIdentity(qr.matrixQ());
+  testQRequalsA(qr.matrixQ(), qr.matrixR(), A);
+
+  // The factorization equals the one computed with modified Gram-Schmidt
+  QRFactorization reference(A, filter);
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < m; j++) {
+      BOOST_TEST(testing::equals(qr.matrixR()(i, j), reference.matrixR()(i, j), 1e-10));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
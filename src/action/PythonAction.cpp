@@ -2,6 +2,7 @@
 #include "PythonAction.hpp"
 #include <Python.h>
 #include <numpy/arrayobject.h>
+#include <vector>
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
@@ -35,6 +36,9 @@ PythonAction::~PythonAction()
   if (_module != nullptr) {
     PRECICE_ASSERT(_moduleNameObject != nullptr);
     PRECICE_ASSERT(_module != nullptr);
+    Py_XDECREF(_dataArgs);
+    Py_XDECREF(_vertexArgs);
+    Py_XDECREF(_verticesArgs);
     Py_DECREF(_moduleNameObject);
     Py_DECREF(_module);
     Py_Finalize();
@@ -51,79 +55,172 @@ void PythonAction::performAction(double time,
   if (not _isInitialized)
     initialize();
 
-  PyObject *dataArgs = PyTuple_New(_numberArguments);
   if (_performAction != nullptr) {
-    PyObject *pythonTime = PyFloat_FromDouble(time);
-    PyObject *pythonDt   = PyFloat_FromDouble(fullDt);
-    PyTuple_SetItem(dataArgs, 0, pythonTime);
-    PyTuple_SetItem(dataArgs, 1, pythonDt);
-    if (_sourceData) {
-      npy_intp sourceDim[]  = {_sourceData->values().size()};
-      double * sourceValues = _sourceData->values().data();
-      //PRECICE_ASSERT(_sourceValues == NULL);
-      _sourceValues = PyArray_SimpleNewFromData(1, sourceDim, NPY_DOUBLE, sourceValues);
-      PRECICE_CHECK(_sourceValues != nullptr, "Creating python source values failed!");
-      PyTuple_SetItem(dataArgs, 2, _sourceValues);
-    }
-    if (_targetData) {
-      npy_intp targetDim[]  = {_targetData->values().size()};
-      double * targetValues = _targetData->values().data();
-      //PRECICE_ASSERT(_targetValues == NULL);
-      _targetValues =
-          PyArray_SimpleNewFromData(1, targetDim, NPY_DOUBLE, targetValues);
-      PRECICE_CHECK(_targetValues != nullptr, "Creating python target values failed!");
-      int argumentIndex = _sourceData ? 3 : 2;
-      PyTuple_SetItem(dataArgs, argumentIndex, _targetValues);
-    }
-    PyObject_CallObject(_performAction, dataArgs);
+    callPerformAction(time, fullDt);
+  }
+
+  if (_vertexCallback != nullptr) {
+    callVertexCallback();
+  }
+
+  if (_verticesCallback != nullptr) {
+    callVerticesCallback();
+  }
+
+  if (_postAction != nullptr) {
+    PyObject *postActionArgs = PyTuple_New(0);
+    PyObject *result         = PyObject_CallObject(_postAction, postActionArgs);
+    Py_XDECREF(result);
     if (PyErr_Occurred()) {
       PyErr_Print();
       PRECICE_ERROR("Error occurred during call of function "
-                    << "performAction() python module \"" << _moduleName << "\"!");
+                    << "postAction() in python module \"" << _moduleName << "\"!");
     }
+    Py_DECREF(postActionArgs);
   }
+}
 
-  if (_vertexCallback != nullptr) {
-    PyObject *      vertexArgs = PyTuple_New(3);
-    mesh::PtrMesh   mesh       = getMesh();
-    Eigen::VectorXd coords(mesh->getDimensions());
-    Eigen::VectorXd normal(mesh->getDimensions());
-    for (mesh::Vertex &vertex : mesh->vertices()) {
-      npy_intp vdim[]        = {mesh->getDimensions()};
-      int      id            = vertex.getID();
-      coords                 = vertex.getCoords();
-      normal                 = vertex.getNormal();
-      PyObject *pythonID     = PyLong_FromLong(id);
-      PyObject *pythonCoords = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
-      PyObject *pythonNormal = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
-      PRECICE_CHECK(pythonID != nullptr, "Creating python ID failed!");
+namespace {
+
+/// Creates a NumPy array viewing the values without copying them, which is two-dimensional if cols > 1.
+PyObject *viewValues(double *values, npy_intp rows, npy_intp cols)
+{
+  npy_intp dims[] = {rows, cols};
+  return PyArray_SimpleNewFromData(cols > 1 ? 2 : 1, dims, NPY_DOUBLE, values);
+}
+
+/// Returns true, if the tuple item is an array viewing exactly the given values.
+bool viewsValues(PyObject *args, Py_ssize_t index, const double *values, npy_intp size)
+{
+  auto array = reinterpret_cast<PyArrayObject *>(PyTuple_GET_ITEM(args, index));
+  return PyArray_DATA(array) == values && PyArray_SIZE(array) == size;
+}
+
+} // namespace
+
+void PythonAction::callPerformAction(double time, double fullDt)
+{
+  // The items of a tuple may only be replaced, as long as nobody else references it
+  if (_dataArgs != nullptr && Py_REFCNT(_dataArgs) != 1) {
+    Py_DECREF(_dataArgs);
+    _dataArgs = nullptr;
+  }
+  const bool created = _dataArgs == nullptr;
+  if (created) {
+    _dataArgs = PyTuple_New(_numberArguments);
+  }
+  PyTuple_SetItem(_dataArgs, 0, PyFloat_FromDouble(time));
+  PyTuple_SetItem(_dataArgs, 1, PyFloat_FromDouble(fullDt));
+
+  // Source data is followed by target data, both are reused while their values do not move
+  int argumentIndex = 2;
+  for (const mesh::PtrData &data : {_sourceData, _targetData}) {
+    if (not data) {
+      continue;
+    }
+    Eigen::VectorXd &values = data->values();
+    if (created || not viewsValues(_dataArgs, argumentIndex, values.data(), values.size())) {
+      PyObject *pythonValues = viewValues(values.data(), values.size(), 1);
+      PRECICE_CHECK(pythonValues != nullptr, "Creating python data values failed!");
+      PyTuple_SetItem(_dataArgs, argumentIndex, pythonValues);
+    }
+    argumentIndex++;
+  }
+
+  PyObject *result = PyObject_CallObject(_performAction, _dataArgs);
+  Py_XDECREF(result);
+  if (PyErr_Occurred()) {
+    PyErr_Print();
+    PRECICE_ERROR("Error occurred during call of function "
+                  << "performAction() python module \"" << _moduleName << "\"!");
+  }
+}
+
+void PythonAction::callVertexCallback()
+{
+  mesh::PtrMesh mesh       = getMesh();
+  const int     dimensions = mesh->getDimensions();
+  for (mesh::Vertex &vertex : mesh->vertices()) {
+    // The items of a tuple may only be replaced, as long as nobody else references it
+    if (_vertexArgs != nullptr && (Py_REFCNT(_vertexArgs) != 1 || _vertexCoords.size() != dimensions)) {
+      Py_DECREF(_vertexArgs);
+      _vertexArgs = nullptr;
+    }
+    if (_vertexArgs == nullptr) {
+      _vertexCoords.resize(dimensions);
+      _vertexNormal.resize(dimensions);
+      PyObject *pythonCoords = viewValues(_vertexCoords.data(), dimensions, 1);
+      PyObject *pythonNormal = viewValues(_vertexNormal.data(), dimensions, 1);
       PRECICE_CHECK(pythonCoords != nullptr, "Creating python coords failed!");
       PRECICE_CHECK(pythonNormal != nullptr, "Creating python normal failed!");
-      PyTuple_SetItem(vertexArgs, 0, pythonID);
-      PyTuple_SetItem(vertexArgs, 1, pythonCoords);
-      PyTuple_SetItem(vertexArgs, 2, pythonNormal);
-      PyObject_CallObject(_vertexCallback, vertexArgs);
-      if (PyErr_Occurred()) {
-        PyErr_Print();
-        PRECICE_ERROR("Error occurred during call of function "
-                      << "vertexCallback() python module \"" << _moduleName << "\"!");
-      }
+      _vertexArgs = PyTuple_New(3);
+      PyTuple_SetItem(_vertexArgs, 1, pythonCoords);
+      PyTuple_SetItem(_vertexArgs, 2, pythonNormal);
     }
-    Py_DECREF(vertexArgs);
-  }
 
-  if (_postAction != nullptr) {
-    PyObject *postActionArgs = PyTuple_New(0);
-    PyObject_CallObject(_postAction, postActionArgs);
+    _vertexCoords          = vertex.getCoords();
+    _vertexNormal          = vertex.getNormal();
+    PyObject *pythonID     = PyLong_FromLong(vertex.getID());
+    PRECICE_CHECK(pythonID != nullptr, "Creating python ID failed!");
+    PyTuple_SetItem(_vertexArgs, 0, pythonID);
+    PyObject *result = PyObject_CallObject(_vertexCallback, _vertexArgs);
+    Py_XDECREF(result);
     if (PyErr_Occurred()) {
       PyErr_Print();
       PRECICE_ERROR("Error occurred during call of function "
-                    << "postAction() in python module \"" << _moduleName << "\"!");
+                    << "vertexCallback() python module \"" << _moduleName << "\"!");
     }
-    Py_DECREF(postActionArgs);
   }
+}
+
+void PythonAction::callVerticesCallback()
+{
+  mesh::PtrMesh  mesh       = getMesh();
+  const int      dimensions = mesh->getDimensions();
+  const npy_intp size       = mesh->vertices().size();
 
-  Py_DECREF(dataArgs);
+  // Coordinates and normals are not contiguous in the mesh, hence they are gathered
+  _coords.resize(size, dimensions);
+  _normals.resize(size, dimensions);
+  for (npy_intp i = 0; i < size; i++) {
+    const mesh::Vertex &vertex = mesh->vertices()[i];
+    _coords.row(i)             = vertex.getCoords().transpose();
+    _normals.row(i)            = vertex.getNormal().transpose();
+  }
+
+  struct View {
+    double * values;
+    npy_intp cols;
+  };
+  std::vector<View> views{{_coords.data(), dimensions}, {_normals.data(), dimensions}};
+  for (const mesh::PtrData &data : {_sourceData, _targetData}) {
+    if (data) {
+      views.push_back({data->values().data(), data->getDimensions()});
+    }
+  }
+
+  // The arguments are reused, as long as all arrays still view the right values
+  bool valid = _verticesArgs != nullptr;
+  for (std::size_t i = 0; valid && i < views.size(); i++) {
+    valid = viewsValues(_verticesArgs, i, views[i].values, size * views[i].cols);
+  }
+  if (not valid) {
+    Py_XDECREF(_verticesArgs);
+    _verticesArgs = PyTuple_New(views.size());
+    for (std::size_t i = 0; i < views.size(); i++) {
+      PyObject *pythonValues = viewValues(views[i].values, size, views[i].cols);
+      PRECICE_CHECK(pythonValues != nullptr, "Creating python arrays for verticesCallback() failed!");
+      PyTuple_SetItem(_verticesArgs, i, pythonValues);
+    }
+  }
+
+  PyObject *result = PyObject_CallObject(_verticesCallback, _verticesArgs);
+  Py_XDECREF(result);
+  if (PyErr_Occurred()) {
+    PyErr_Print();
+    PRECICE_ERROR("Error occurred during call of function "
+                  << "verticesCallback() python module \"" << _moduleName << "\"!");
+  }
 }
 
 void PythonAction::initialize()
@@ -163,6 +260,14 @@ void PythonAction::initialize()
     _vertexCallback = nullptr;
   }
 
+  // Construct method verticesCallback, which is optional
+  _verticesCallback = PyObject_GetAttrString(_module, "verticesCallback");
+  if (PyErr_Occurred()) {
+    PyErr_Clear();
+    PRECICE_DEBUG("No function void verticesCallback() in python module \"" << _moduleName << "\" found.");
+    _verticesCallback = nullptr;
+  }
+
   // Construct function postAction
   _postAction = PyObject_GetAttrString(_module, "postAction");
   if (PyErr_Occurred()) {
@@ -170,6 +275,7 @@ void PythonAction::initialize()
     PRECICE_WARN("No function void postAction() in python module \"" << _moduleName << "\" found.");
     _postAction = nullptr;
   }
+  _isInitialized = true;
 }
 
 int PythonAction::makeNumPyArraysAvailable()
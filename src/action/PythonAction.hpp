@@ -1,6 +1,7 @@
 #pragma once
 #ifndef PRECICE_NO_PYTHON
 
+#include <Eigen/Core>
 #include <string>
 #include "action/Action.hpp"
 #include "logging/Logger.hpp"
@@ -50,19 +51,45 @@ private:
 
   PyObject *_module = nullptr;
 
-  PyObject *_sourceValues = nullptr;
-
-  PyObject *_targetValues = nullptr;
-
   PyObject *_performAction = nullptr;
 
   PyObject *_vertexCallback = nullptr;
 
+  PyObject *_verticesCallback = nullptr;
+
   PyObject *_postAction = nullptr;
 
+  /// Arguments of performAction(), reused while the data values do not move
+  PyObject *_dataArgs = nullptr;
+
+  /// Arguments of vertexCallback(), viewing _vertexCoords and _vertexNormal
+  PyObject *_vertexArgs = nullptr;
+
+  /// Arguments of verticesCallback(), viewing _coords, _normals and the data values
+  PyObject *_verticesArgs = nullptr;
+
+  /// Coordinates and normal of the vertex passed to vertexCallback()
+  Eigen::VectorXd _vertexCoords;
+  Eigen::VectorXd _vertexNormal;
+
+  using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  /// Coordinates and normals of all vertices passed to verticesCallback(), one row per vertex
+  RowMajorMatrix _coords;
+  RowMajorMatrix _normals;
+
   void initialize();
 
   int makeNumPyArraysAvailable();
+
+  /// Calls performAction() of the module
+  void callPerformAction(double time, double fullDt);
+
+  /// Calls vertexCallback() of the module for every vertex
+  void callVertexCallback();
+
+  /// Calls verticesCallback() of the module once for all vertices
+  void callVerticesCallback();
 };
 
 } // namespace action
@@ -25,6 +25,17 @@ def vertexCallback(id, coords, normal):
     global mySourceData # Make global data set in performAction visible
     global myTargetData
     # myTargetData[id] += coords[0] + mySourceData[id] # Add data to vertex coords
+
+def verticesCallback(coords, normals, sourceData, targetData):
+    '''This function is called once for all vertices of the configured mesh. It is
+    called after vertexCallback, and can also be omitted. Its parameters are NumPy
+    arrays holding one row per vertex, vector data has one column per component.
+    Source and target data can be omitted like for performAction. The data arrays
+    are views of the preCICE data, hence writing to targetData changes the values.
+    For large meshes, this is much faster than vertexCallback.'''
+
+    # Usage example:
+    # targetData[:] = coords[:, 0] + sourceData # Add data to vertex coords
     
 def postAction():
     '''This function is called at last, if not omitted.'''
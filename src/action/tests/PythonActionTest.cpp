@@ -33,6 +33,30 @@ BOOST_AUTO_TEST_CASE(AllMethods)
   BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
 }
 
+BOOST_AUTO_TEST_CASE(VerticesCallback)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false, testing::nextMeshID()));
+  mesh->createVertex(Eigen::Vector3d::Constant(1.0));
+  mesh->createVertex(Eigen::Vector3d::Constant(2.0));
+  mesh->createVertex(Eigen::Vector3d::Constant(3.0));
+  int targetID = mesh->createData("TargetData", 1)->getID();
+  int sourceID = mesh->createData("SourceData", 1)->getID();
+  mesh->allocateDataValues();
+  std::string  path = testing::getPathToSources() + "/action/tests/";
+  PythonAction action(PythonAction::ALWAYS_PRIOR, path, "TestBulkAction", mesh, targetID, sourceID);
+  mesh->data(sourceID)->values() << 0.1, 0.2, 0.3;
+  action.performAction(0.0, 0.0, 0.0, 0.0);
+  Eigen::Vector3d result(1.1, 2.2, 3.3);
+  BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
+
+  // The cached arguments follow moved vertices and changed values
+  mesh->vertices()[0].setCoords(Eigen::Vector3d::Constant(4.0));
+  mesh->data(sourceID)->values() << 1.0, 1.0, 1.0;
+  action.performAction(0.0, 0.0, 0.0, 0.0);
+  result << 5.0, 3.0, 4.0;
+  BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
+}
+
 BOOST_AUTO_TEST_CASE(OmitMethods)
 {
   std::string path = testing::getPathToSources() + "/action/tests/";
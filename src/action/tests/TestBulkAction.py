@@ -0,0 +1,6 @@
+#
+# This function is called once for all vertices of the configured mesh. Its
+# parameters are arrays holding one row per vertex.
+#
+def verticesCallback(coords, normals, sourceData, targetData):
+    targetData[:] = sourceData + coords[:, 0]
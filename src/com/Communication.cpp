@@ -1,5 +1,6 @@
 #include "Communication.hpp"
 #include "Request.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace com {
@@ -284,5 +285,101 @@ void Communication::broadcast(std::vector<double> &v, int rankBroadcaster)
   broadcast(v.data(), size, rankBroadcaster);
 }
 
+void Communication::gather(std::vector<int> const &itemsToSend, int rankMaster)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankMaster);
+
+  send(static_cast<int>(itemsToSend.size()), rankMaster);
+  if (not itemsToSend.empty()) {
+    send(itemsToSend, rankMaster);
+  }
+}
+
+void Communication::gather(std::vector<int> const &itemsToSend, std::vector<int> &itemsToReceive, std::vector<int> &counts)
+{
+  PRECICE_TRACE(itemsToSend.size());
+
+  itemsToReceive = itemsToSend;
+  counts.assign(1, static_cast<int>(itemsToSend.size()));
+
+  // receive vectors from slaves
+  std::vector<int> received;
+  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
+    int size = 0;
+    receive(size, rank + _rankOffset);
+    counts.push_back(size);
+    if (size != 0) {
+      receive(received, rank + _rankOffset);
+      PRECICE_ASSERT(static_cast<int>(received.size()) == size, received.size(), size);
+      itemsToReceive.insert(itemsToReceive.end(), received.begin(), received.end());
+    }
+  }
+}
+
+/**
+ * The vectors are routed through the master, which receives all vectors of all
+ * slaves before sending them on.
+ */
+void Communication::allToAll(std::vector<std::vector<int>> const &itemsToSend, std::vector<std::vector<int>> &itemsToReceive)
+{
+  PRECICE_TRACE(itemsToSend.size());
+  const size_t size = getRemoteCommunicatorSize() + 1;
+  PRECICE_ASSERT(itemsToSend.size() == size, itemsToSend.size(), size);
+
+  // vectors per sending rank and receiving rank
+  std::vector<std::vector<std::vector<int>>> routed(size);
+  routed[0] = itemsToSend;
+
+  // receive vectors from slaves
+  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
+    routed[rank + 1].resize(size);
+    for (auto &items : routed[rank + 1]) {
+      int count = 0;
+      receive(count, rank + _rankOffset);
+      if (count != 0) {
+        receive(items, rank + _rankOffset);
+      }
+    }
+  }
+
+  // send vectors to slaves
+  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
+    for (size_t sender = 0; sender < size; ++sender) {
+      const auto &items = routed[sender][rank + 1];
+      send(static_cast<int>(items.size()), rank + _rankOffset);
+      if (not items.empty()) {
+        send(items, rank + _rankOffset);
+      }
+    }
+  }
+
+  itemsToReceive.resize(size);
+  for (size_t sender = 0; sender < size; ++sender) {
+    itemsToReceive[sender] = std::move(routed[sender][0]);
+  }
+}
+
+void Communication::allToAll(std::vector<std::vector<int>> const &itemsToSend, std::vector<std::vector<int>> &itemsToReceive, int rankMaster)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankMaster);
+
+  for (const auto &items : itemsToSend) {
+    send(static_cast<int>(items.size()), rankMaster);
+    if (not items.empty()) {
+      send(items, rankMaster);
+    }
+  }
+
+  itemsToReceive.resize(itemsToSend.size());
+  for (auto &items : itemsToReceive) {
+    int count = 0;
+    receive(count, rankMaster);
+    items.clear();
+    if (count != 0) {
+      receive(items, rankMaster);
+    }
+  }
+}
+
 } // namespace com
 } // namespace precice
@@ -221,6 +221,38 @@ public:
 
   /// @}
 
+  /// @name Gather
+  /// @{
+
+  /// Gathers the vectors of all ranks on the rank given by rankMaster
+  virtual void gather(std::vector<int> const &itemsToSend, int rankMaster);
+
+  /**
+   * @brief Gathers the vectors of all ranks on the master, every other rank has to call gather
+   *
+   * @param[in] itemsToSend Vector of the master
+   * @param[out] itemsToReceive Concatenated vectors of all ranks, ordered by rank
+   * @param[out] counts Size of the vector of each rank
+   */
+  virtual void gather(std::vector<int> const &itemsToSend, std::vector<int> &itemsToReceive, std::vector<int> &counts);
+
+  /// @}
+
+  /// @name All-to-all
+  /// @{
+
+  /**
+   * @brief Sends itemsToSend[rank] to every rank and receives the vector sent by every rank into itemsToReceive[rank]
+   *
+   * Performed on the master, every other rank has to call allToAll with rankMaster.
+   * Empty vectors are cheap, such that ranks can exchange data with their neighbors only.
+   */
+  virtual void allToAll(std::vector<std::vector<int>> const &itemsToSend, std::vector<std::vector<int>> &itemsToReceive);
+
+  virtual void allToAll(std::vector<std::vector<int>> const &itemsToSend, std::vector<std::vector<int>> &itemsToReceive, int rankMaster);
+
+  /// @}
+
   /// @name Send
   /// @{
 
@@ -121,6 +121,10 @@ int MPIDirectCommunication::getLeaderRank(std::string const &accessorName)
 void MPIDirectCommunication::reduceSum(double *itemsToSend, double *itemsToReceive, int size)
 {
   PRECICE_TRACE(size);
+  if (not spansGlobalCommunicator()) {
+    Communication::reduceSum(itemsToSend, itemsToReceive, size);
+    return;
+  }
   int rank = -1;
   MPI_Comm_rank(_globalCommunicator, &rank);
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
@@ -130,6 +134,10 @@ void MPIDirectCommunication::reduceSum(double *itemsToSend, double *itemsToRecei
 void MPIDirectCommunication::reduceSum(double *itemsToSend, double *itemsToReceive, int size, int rankMaster)
 {
   PRECICE_TRACE(size);
+  if (not spansGlobalCommunicator()) {
+    Communication::reduceSum(itemsToSend, itemsToReceive, size, rankMaster);
+    return;
+  }
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
   MPI_Reduce(itemsToSend, itemsToReceive, size, MPI_DOUBLE, MPI_SUM, rankMaster, _globalCommunicator);
 }
@@ -137,6 +145,10 @@ void MPIDirectCommunication::reduceSum(double *itemsToSend, double *itemsToRecei
 void MPIDirectCommunication::reduceSum(int itemToSend, int &itemsToReceive)
 {
   PRECICE_TRACE();
+  if (not spansGlobalCommunicator()) {
+    Communication::reduceSum(itemToSend, itemsToReceive);
+    return;
+  }
   int rank = -1;
   MPI_Comm_rank(_globalCommunicator, &rank);
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
@@ -146,6 +158,10 @@ void MPIDirectCommunication::reduceSum(int itemToSend, int &itemsToReceive)
 void MPIDirectCommunication::reduceSum(int itemToSend, int &itemsToReceive, int rankMaster)
 {
   PRECICE_TRACE();
+  if (not spansGlobalCommunicator()) {
+    Communication::reduceSum(itemToSend, itemsToReceive, rankMaster);
+    return;
+  }
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
   MPI_Reduce(&itemToSend, &itemsToReceive, 1, MPI_INT, MPI_SUM, rankMaster, _globalCommunicator);
 }
@@ -153,6 +169,10 @@ void MPIDirectCommunication::reduceSum(int itemToSend, int &itemsToReceive, int
 void MPIDirectCommunication::allreduceSum(double *itemsToSend, double *itemsToReceive, int size)
 {
   PRECICE_TRACE(size);
+  if (not spansGlobalCommunicator()) {
+    Communication::allreduceSum(itemsToSend, itemsToReceive, size);
+    return;
+  }
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
   MPI_Allreduce(itemsToSend, itemsToReceive, size, MPI_DOUBLE, MPI_SUM, _globalCommunicator);
 }
@@ -160,6 +180,10 @@ void MPIDirectCommunication::allreduceSum(double *itemsToSend, double *itemsToRe
 void MPIDirectCommunication::allreduceSum(double *itemsToSend, double *itemsToReceive, int size, int rankMaster)
 {
   PRECICE_TRACE(size);
+  if (not spansGlobalCommunicator()) {
+    Communication::allreduceSum(itemsToSend, itemsToReceive, size, rankMaster);
+    return;
+  }
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
   MPI_Allreduce(itemsToSend, itemsToReceive, size, MPI_DOUBLE, MPI_SUM, _globalCommunicator);
 }
@@ -167,6 +191,10 @@ void MPIDirectCommunication::allreduceSum(double *itemsToSend, double *itemsToRe
 void MPIDirectCommunication::allreduceSum(double itemToSend, double &itemToReceive)
 {
   PRECICE_TRACE();
+  if (not spansGlobalCommunicator()) {
+    Communication::allreduceSum(itemToSend, itemToReceive);
+    return;
+  }
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
   MPI_Allreduce(&itemToSend, &itemToReceive, 1, MPI_DOUBLE, MPI_SUM, _globalCommunicator);
 }
@@ -174,6 +202,10 @@ void MPIDirectCommunication::allreduceSum(double itemToSend, double &itemToRecei
 void MPIDirectCommunication::allreduceSum(double itemToSend, double &itemToReceive, int rankMaster)
 {
   PRECICE_TRACE();
+  if (not spansGlobalCommunicator()) {
+    Communication::allreduceSum(itemToSend, itemToReceive, rankMaster);
+    return;
+  }
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
   MPI_Allreduce(&itemToSend, &itemToReceive, 1, MPI_DOUBLE, MPI_SUM, _globalCommunicator);
 }
@@ -181,6 +213,10 @@ void MPIDirectCommunication::allreduceSum(double itemToSend, double &itemToRecei
 void MPIDirectCommunication::allreduceSum(int itemToSend, int &itemToReceive)
 {
   PRECICE_TRACE();
+  if (not spansGlobalCommunicator()) {
+    Communication::allreduceSum(itemToSend, itemToReceive);
+    return;
+  }
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
   MPI_Allreduce(&itemToSend, &itemToReceive, 1, MPI_INT, MPI_SUM, _globalCommunicator);
 }
@@ -188,6 +224,10 @@ void MPIDirectCommunication::allreduceSum(int itemToSend, int &itemToReceive)
 void MPIDirectCommunication::allreduceSum(int itemToSend, int &itemToReceive, int rankMaster)
 {
   PRECICE_TRACE();
+  if (not spansGlobalCommunicator()) {
+    Communication::allreduceSum(itemToSend, itemToReceive, rankMaster);
+    return;
+  }
   // _comunicator did't work here as we seem to have two communicators, one with the master and one with the slaves
   MPI_Allreduce(&itemToSend, &itemToReceive, 1, MPI_INT, MPI_SUM, _globalCommunicator);
 }
@@ -259,6 +299,102 @@ void MPIDirectCommunication::broadcast(bool &itemToReceive, int rankBroadcaster)
   itemToReceive = item;
 }
 
+void MPIDirectCommunication::gather(std::vector<int> const &itemsToSend, int rankMaster)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankMaster);
+  if (not spansGlobalCommunicator()) {
+    Communication::gather(itemsToSend, rankMaster);
+    return;
+  }
+  int size = itemsToSend.size();
+  MPI_Gather(&size, 1, MPI_INT, nullptr, 1, MPI_INT, rankMaster, _globalCommunicator);
+  MPI_Gatherv(const_cast<int *>(itemsToSend.data()), size, MPI_INT, nullptr, nullptr, nullptr, MPI_INT, rankMaster, _globalCommunicator);
+}
+
+void MPIDirectCommunication::gather(std::vector<int> const &itemsToSend, std::vector<int> &itemsToReceive, std::vector<int> &counts)
+{
+  PRECICE_TRACE(itemsToSend.size());
+  if (not spansGlobalCommunicator()) {
+    Communication::gather(itemsToSend, itemsToReceive, counts);
+    return;
+  }
+  int rank = -1;
+  int size = -1;
+  MPI_Comm_rank(_globalCommunicator, &rank);
+  MPI_Comm_size(_globalCommunicator, &size);
+
+  int count = itemsToSend.size();
+  counts.resize(size);
+  MPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, rank, _globalCommunicator);
+
+  std::vector<int> displacements(size, 0);
+  for (int i = 1; i < size; i++) {
+    displacements[i] = displacements[i - 1] + counts[i - 1];
+  }
+  itemsToReceive.resize(displacements.back() + counts.back());
+  MPI_Gatherv(const_cast<int *>(itemsToSend.data()), count, MPI_INT, itemsToReceive.data(), counts.data(),
+              displacements.data(), MPI_INT, rank, _globalCommunicator);
+}
+
+void MPIDirectCommunication::allToAll(std::vector<std::vector<int>> const &itemsToSend, std::vector<std::vector<int>> &itemsToReceive)
+{
+  PRECICE_TRACE(itemsToSend.size());
+  if (not spansGlobalCommunicator()) {
+    Communication::allToAll(itemsToSend, itemsToReceive);
+    return;
+  }
+  int size = -1;
+  MPI_Comm_size(_globalCommunicator, &size);
+  PRECICE_ASSERT(static_cast<int>(itemsToSend.size()) == size, itemsToSend.size(), size);
+
+  std::vector<int> sendCounts(size);
+  std::vector<int> sendDisplacements(size);
+  std::vector<int> sendBuffer;
+  for (int i = 0; i < size; i++) {
+    sendCounts[i]        = itemsToSend[i].size();
+    sendDisplacements[i] = sendBuffer.size();
+    sendBuffer.insert(sendBuffer.end(), itemsToSend[i].begin(), itemsToSend[i].end());
+  }
+
+  std::vector<int> receiveCounts(size);
+  MPI_Alltoall(sendCounts.data(), 1, MPI_INT, receiveCounts.data(), 1, MPI_INT, _globalCommunicator);
+
+  std::vector<int> receiveDisplacements(size, 0);
+  for (int i = 1; i < size; i++) {
+    receiveDisplacements[i] = receiveDisplacements[i - 1] + receiveCounts[i - 1];
+  }
+  std::vector<int> receiveBuffer(receiveDisplacements.back() + receiveCounts.back());
+  MPI_Alltoallv(sendBuffer.data(), sendCounts.data(), sendDisplacements.data(), MPI_INT,
+                receiveBuffer.data(), receiveCounts.data(), receiveDisplacements.data(), MPI_INT, _globalCommunicator);
+
+  itemsToReceive.resize(size);
+  for (int i = 0; i < size; i++) {
+    auto begin = receiveBuffer.begin() + receiveDisplacements[i];
+    itemsToReceive[i].assign(begin, begin + receiveCounts[i]);
+  }
+}
+
+void MPIDirectCommunication::allToAll(std::vector<std::vector<int>> const &itemsToSend, std::vector<std::vector<int>> &itemsToReceive, int rankMaster)
+{
+  PRECICE_TRACE(itemsToSend.size(), rankMaster);
+  if (not spansGlobalCommunicator()) {
+    Communication::allToAll(itemsToSend, itemsToReceive, rankMaster);
+    return;
+  }
+  allToAll(itemsToSend, itemsToReceive);
+}
+
+bool MPIDirectCommunication::spansGlobalCommunicator()
+{
+  int localSize  = 0;
+  int remoteSize = 0;
+  int globalSize = 0;
+  MPI_Comm_size(communicator(), &localSize);
+  MPI_Comm_remote_size(communicator(), &remoteSize);
+  MPI_Comm_size(_globalCommunicator, &globalSize);
+  return localSize + remoteSize == globalSize;
+}
+
 MPI_Comm &MPIDirectCommunication::communicator(int rank)
 {
   return _communicator;
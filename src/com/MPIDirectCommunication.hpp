@@ -107,11 +107,27 @@ public:
 
   virtual void broadcast(bool &itemToReceive, int rankBroadcaster) override;
 
+  virtual void gather(std::vector<int> const &itemsToSend, int rankMaster) override;
+
+  virtual void gather(std::vector<int> const &itemsToSend, std::vector<int> &itemsToReceive, std::vector<int> &counts) override;
+
+  virtual void allToAll(std::vector<std::vector<int>> const &itemsToSend, std::vector<std::vector<int>> &itemsToReceive) override;
+
+  virtual void allToAll(std::vector<std::vector<int>> const &itemsToSend, std::vector<std::vector<int>> &itemsToReceive, int rankMaster) override;
+
 private:
   virtual MPI_Comm &communicator(int rank = 0) override;
 
   virtual int rank(int rank) override;
 
+  /**
+   * @brief Checks whether both sides of the connection form the global communicator.
+   *
+   * Only then the collective operations can run on the global communicator.
+   * Otherwise, e.g. if several participants share it, they fall back to point-to-point communication.
+   */
+  bool spansGlobalCommunicator();
+
   logging::Logger _log{"com::MPIDirectCommunication"};
 
   MPI_Comm _communicator;
@@ -2,7 +2,9 @@
 
 #include "GenericTestFunctions.hpp"
 #include "com/MPIDirectCommunication.hpp"
+#include "testing/Fixtures.hpp"
 #include "testing/Testing.hpp"
+#include "utils/MasterSlave.hpp"
 
 using namespace precice;
 using namespace precice::com;
@@ -17,6 +19,51 @@ BOOST_AUTO_TEST_CASE(SendAndReceive,
   TestSendAndReceive<MPIDirectCommunication>();
 }
 
+BOOST_AUTO_TEST_CASE(Gather,
+                     *testing::OnSize(4) * boost::unit_test::fixture<testing::MasterComFixture>())
+{
+  // Rank r contributes r copies of r
+  const int        rank = utils::Parallel::getProcessRank();
+  std::vector<int> items(rank, rank);
+
+  if (rank == 0) {
+    std::vector<int> gathered;
+    std::vector<int> counts;
+    utils::MasterSlave::_communication->gather(items, gathered, counts);
+    BOOST_TEST(counts == std::vector<int>({0, 1, 2, 3}));
+    BOOST_TEST(gathered == std::vector<int>({1, 2, 2, 3, 3, 3}));
+  } else {
+    utils::MasterSlave::_communication->gather(items, 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(AllToAll,
+                     *testing::OnSize(4) * boost::unit_test::fixture<testing::MasterComFixture>())
+{
+  // Rank r sends {r, target} to every higher rank and nothing to the others
+  const int                     rank = utils::Parallel::getProcessRank();
+  std::vector<std::vector<int>> items(4);
+  for (int target = rank + 1; target < 4; target++) {
+    items[target] = {rank, target};
+  }
+
+  std::vector<std::vector<int>> received;
+  if (rank == 0) {
+    utils::MasterSlave::_communication->allToAll(items, received);
+  } else {
+    utils::MasterSlave::_communication->allToAll(items, received, 0);
+  }
+
+  BOOST_TEST(received.size() == 4);
+  for (int sender = 0; sender < 4; sender++) {
+    if (sender < rank) {
+      BOOST_TEST(received[sender] == std::vector<int>({sender, rank}));
+    } else {
+      BOOST_TEST(received[sender].empty());
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // MPIDirectCommunication
 
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -171,10 +171,8 @@ std::vector<int> BaseCouplingScheme::sendData(m2n::PtrM2N m2n)
   std::vector<int> sentDataIDs;
   PRECICE_ASSERT(m2n.get() != nullptr);
   PRECICE_ASSERT(m2n->isConnected());
+  sendPackedData(*m2n, _sendData);
   for (const DataMap::value_type &pair : _sendData) {
-    //std::cout<<"\nsend data id="<<pair.first<<": "<<*(pair.second->values)<<'\n';
-    int size = pair.second->values->size();
-    m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
     sentDataIDs.push_back(pair.first);
   }
   PRECICE_DEBUG("Number of sent data sets = " << sentDataIDs.size());
@@ -189,9 +187,8 @@ std::vector<int> BaseCouplingScheme::receiveData(
   PRECICE_ASSERT(m2n.get() != nullptr);
   PRECICE_ASSERT(m2n->isConnected());
 
+  receivePackedData(*m2n, _receiveData);
   for (DataMap::value_type &pair : _receiveData) {
-    int size = pair.second->values->size();
-    m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
     receivedDataIDs.push_back(pair.first);
   }
   PRECICE_DEBUG("Number of received data sets = " << receivedDataIDs.size());
@@ -199,6 +196,109 @@ std::vector<int> BaseCouplingScheme::receiveData(
   return receivedDataIDs;
 }
 
+namespace {
+using DataGroup = std::vector<CouplingData *>;
+
+/// Groups the data by mesh ID, keeping the order of the data IDs within every group.
+std::map<int, DataGroup> groupByMesh(const BaseCouplingScheme::DataMap &dataMap)
+{
+  std::map<int, DataGroup> groups;
+  for (const BaseCouplingScheme::DataMap::value_type &pair : dataMap) {
+    groups[pair.second->mesh->getID()].push_back(pair.second.get());
+  }
+  return groups;
+}
+
+/// Returns the summed dimension of the data
+int packedDimension(const DataGroup &group)
+{
+  int dimension = 0;
+  for (const CouplingData *data : group) {
+    dimension += data->dimension;
+  }
+  return dimension;
+}
+
+/// Returns the amount of vertices the data is defined on
+Eigen::Index vertexCount(const DataGroup &group)
+{
+  return group.front()->values->size() / group.front()->dimension;
+}
+} // namespace
+
+void BaseCouplingScheme::sendPackedData(m2n::M2N &m2n, const DataMap &dataMap)
+{
+  PRECICE_TRACE();
+  for (const auto &meshGroup : groupByMesh(dataMap)) {
+    const int        meshID = meshGroup.first;
+    const DataGroup &group  = meshGroup.second;
+    if (group.size() == 1) {
+      m2n.send(group.front()->values->data(), group.front()->values->size(), meshID, group.front()->dimension);
+      continue;
+    }
+    const int          dimension = packedDimension(group);
+    const Eigen::Index vertices  = vertexCount(group);
+    _packedValues.resize(vertices * dimension);
+    Eigen::Map<Eigen::MatrixXd> packed(_packedValues.data(), dimension, vertices);
+    int                         offset = 0;
+    for (const CouplingData *data : group) {
+      PRECICE_ASSERT(data->values->size() == vertices * data->dimension, data->values->size(), vertices, data->dimension);
+      packed.middleRows(offset, data->dimension) = Eigen::Map<const Eigen::MatrixXd>(data->values->data(), data->dimension, vertices);
+      offset += data->dimension;
+    }
+    PRECICE_DEBUG("Send " << group.size() << " data sets of mesh " << meshID << " as one message");
+    m2n.send(_packedValues.data(), _packedValues.size(), meshID, dimension);
+  }
+}
+
+void BaseCouplingScheme::receivePackedData(m2n::M2N &m2n, DataMap &dataMap)
+{
+  PRECICE_TRACE();
+  startReceivePackedData(m2n, dataMap, _packedReceiveBuffers);
+  m2n.completeReceive();
+  unpackReceivedData(dataMap, _packedReceiveBuffers);
+}
+
+void BaseCouplingScheme::startReceivePackedData(m2n::M2N &m2n, const DataMap &dataMap, PackedBuffers &buffers)
+{
+  PRECICE_TRACE();
+  for (const auto &meshGroup : groupByMesh(dataMap)) {
+    const int        meshID = meshGroup.first;
+    const DataGroup &group  = meshGroup.second;
+    if (group.size() == 1) {
+      m2n.startReceive(group.front()->values->data(), group.front()->values->size(), meshID, group.front()->dimension);
+      continue;
+    }
+    const int        dimension = packedDimension(group);
+    Eigen::VectorXd &buffer    = buffers[meshID];
+    buffer.resize(vertexCount(group) * dimension);
+    PRECICE_DEBUG("Receive " << group.size() << " data sets of mesh " << meshID << " as one message");
+    m2n.startReceive(buffer.data(), buffer.size(), meshID, dimension);
+  }
+}
+
+void BaseCouplingScheme::unpackReceivedData(const DataMap &dataMap, const PackedBuffers &buffers)
+{
+  PRECICE_TRACE();
+  for (const auto &meshGroup : groupByMesh(dataMap)) {
+    const DataGroup &group = meshGroup.second;
+    if (group.size() == 1) {
+      continue;
+    }
+    PRECICE_ASSERT(buffers.count(meshGroup.first) == 1, meshGroup.first);
+    const int                         dimension = packedDimension(group);
+    const Eigen::Index                vertices  = vertexCount(group);
+    const Eigen::VectorXd &           buffer    = buffers.at(meshGroup.first);
+    Eigen::Map<const Eigen::MatrixXd> packed(buffer.data(), dimension, vertices);
+    int                               offset = 0;
+    for (CouplingData *data : group) {
+      PRECICE_ASSERT(data->values->size() == vertices * data->dimension, data->values->size(), vertices, data->dimension);
+      Eigen::Map<Eigen::MatrixXd>(data->values->data(), data->dimension, vertices) = packed.middleRows(offset, data->dimension);
+      offset += data->dimension;
+    }
+  }
+}
+
 int BaseCouplingScheme::getVertexOffset(
     std::map<int, int> &vertexDistribution,
     int                 rank,
@@ -564,6 +664,47 @@ void BaseCouplingScheme::addConvergenceMeasure(
   _firstResiduumNorm.push_back(0);
 }
 
+void BaseCouplingScheme::performMeasurements(
+    bool                            coarseModelOptimization,
+    std::map<int, Eigen::VectorXd> &designSpecifications)
+{
+  PRECICE_TRACE(coarseModelOptimization);
+  std::vector<double> localSums;
+  std::vector<int>    offsets(_convergenceMeasures.size(), -1);
+  for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
+    ConvergenceMeasure &convMeasure = _convergenceMeasures[i];
+    if ((convMeasure.level > 0) != coarseModelOptimization)
+      continue;
+
+    PRECICE_ASSERT(convMeasure.couplingData != nullptr);
+    PRECICE_ASSERT(convMeasure.measure.get() != nullptr);
+    const auto &    oldValues = convMeasure.couplingData->oldValues.col(0);
+    Eigen::VectorXd q         = Eigen::VectorXd::Zero(convMeasure.couplingData->values->size());
+    if (designSpecifications.find(convMeasure.data->getID()) != designSpecifications.end())
+      q = designSpecifications.at(convMeasure.data->getID());
+
+    const int sumCount = convMeasure.measure->getSumCount();
+    if (sumCount == 0) {
+      convMeasure.measure->measure(oldValues, *convMeasure.couplingData->values, q);
+      continue;
+    }
+    offsets[i] = localSums.size();
+    localSums.resize(localSums.size() + sumCount, 0.0);
+    convMeasure.measure->addLocalSums(oldValues, *convMeasure.couplingData->values, q, &localSums[offsets[i]]);
+  }
+
+  if (localSums.empty()) {
+    return;
+  }
+  std::vector<double> globalSums(localSums.size());
+  utils::MasterSlave::allreduceSum(localSums.data(), globalSums.data(), localSums.size());
+  for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
+    if (offsets[i] >= 0) {
+      _convergenceMeasures[i].measure->completeMeasurement(&globalSums[offsets[i]]);
+    }
+  }
+}
+
 bool BaseCouplingScheme::measureConvergence(
     std::map<int, Eigen::VectorXd> &designSpecifications)
 {
@@ -572,6 +713,7 @@ bool BaseCouplingScheme::measureConvergence(
   bool allConverged = true;
   bool oneSuffices  = false;
   PRECICE_ASSERT(_convergenceMeasures.size() > 0);
+  performMeasurements(false, designSpecifications);
   if (not utils::MasterSlave::isSlave()) {
     _convergenceWriter->writeData("Timestep", _timesteps);
     _convergenceWriter->writeData("Iteration", _iterations);
@@ -583,15 +725,6 @@ bool BaseCouplingScheme::measureConvergence(
     if (convMeasure.level > 0)
       continue;
 
-    PRECICE_ASSERT(convMeasure.couplingData != nullptr);
-    PRECICE_ASSERT(convMeasure.measure.get() != nullptr);
-    const auto &    oldValues = convMeasure.couplingData->oldValues.col(0);
-    Eigen::VectorXd q         = Eigen::VectorXd::Zero(convMeasure.couplingData->values->size());
-    if (designSpecifications.find(convMeasure.data->getID()) != designSpecifications.end())
-      q = designSpecifications.at(convMeasure.data->getID());
-
-    convMeasure.measure->measure(oldValues, *convMeasure.couplingData->values, q);
-
     if (not utils::MasterSlave::isSlave()) {
       std::stringstream sstm;
       sstm << "ResNorm(" << convMeasure.data->getName() << ")";
@@ -627,6 +760,7 @@ bool BaseCouplingScheme::measureConvergenceCoarseModelOptimization(
   bool allConverged = true;
   bool oneSuffices  = false;
   PRECICE_ASSERT(_convergenceMeasures.size() > 0);
+  performMeasurements(true, designSpecifications);
   for (ConvergenceMeasure &convMeasure : _convergenceMeasures) {
 
     // only apply convergence measures for coarse model optimization
@@ -634,15 +768,6 @@ bool BaseCouplingScheme::measureConvergenceCoarseModelOptimization(
       continue;
 
     std::cout << "  measure convergence coarse measure, data:" << convMeasure.data->getName() << '\n';
-    PRECICE_ASSERT(convMeasure.couplingData != nullptr);
-    PRECICE_ASSERT(convMeasure.measure.get() != nullptr);
-    const auto &    oldValues = convMeasure.couplingData->oldValues.col(0);
-    Eigen::VectorXd q         = Eigen::VectorXd::Zero(convMeasure.couplingData->values->size());
-    if (designSpecifications.find(convMeasure.data->getID()) != designSpecifications.end())
-      q = designSpecifications.at(convMeasure.data->getID());
-
-    convMeasure.measure->measure(oldValues, *convMeasure.couplingData->values, q);
-
     if (not convMeasure.measure->isConvergence()) {
       allConverged = false;
     } else if (convMeasure.suffices == true) {
@@ -262,6 +262,32 @@ protected:
   /// Receives data receiveDataIDs given in mapCouplingData with communication.
   std::vector<int> receiveData(m2n::PtrM2N m2n);
 
+  /**
+   * @brief Sends all data of the map, where all data of a mesh is sent as one message.
+   *
+   * The values of the data of a mesh are interleaved vertex by vertex in the order
+   * of the data IDs. Hence, the receiver has to call receivePackedData() with the
+   * same data IDs.
+   */
+  void sendPackedData(m2n::M2N &m2n, const DataMap &dataMap);
+
+  /// Receives all data of the map, which was sent by sendPackedData().
+  void receivePackedData(m2n::M2N &m2n, DataMap &dataMap);
+
+  /// Buffers of interleaved values per mesh ID
+  using PackedBuffers = std::map<int, Eigen::VectorXd>;
+
+  /**
+   * @brief Starts receiving all data of the map, see receivePackedData().
+   *
+   * The data is available after calling m2n.completeReceive() and unpackReceivedData().
+   * The buffers have to stay untouched until then.
+   */
+  void startReceivePackedData(m2n::M2N &m2n, const DataMap &dataMap, PackedBuffers &buffers);
+
+  /// Copies the values received by startReceivePackedData() into the data.
+  void unpackReceivedData(const DataMap &dataMap, const PackedBuffers &buffers);
+
   /// Returns all data to be sent.
   const DataMap &getSendData() const
   {
@@ -428,6 +454,16 @@ protected:
 
   void newConvergenceMeasurements();
 
+  /**
+   * @brief Performs the measurements of all convergence measures of fine or coarse model optimization.
+   *
+   * The sums of all measures, which are split into local sums, are reduced in
+   * a single collective operation over all ranks.
+   */
+  void performMeasurements(
+      bool                            coarseModelOptimization,
+      std::map<int, Eigen::VectorXd> &designSpecifications);
+
   bool measureConvergence(
       std::map<int, Eigen::VectorXd> &designSpecification);
 
@@ -546,6 +582,12 @@ private:
   /// Map from data ID -> all receive data with that ID
   DataMap _receiveData;
 
+  /// Buffer of the interleaved values of sendPackedData()
+  Eigen::VectorXd _packedValues;
+
+  /// Buffers of the interleaved values of receivePackedData()
+  PackedBuffers _packedReceiveBuffers;
+
   /// Responsible for monitoring iteration count over timesteps.
   std::shared_ptr<io::TXTTableWriter> _iterationsWriter;
 
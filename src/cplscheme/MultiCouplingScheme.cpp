@@ -1,5 +1,6 @@
 #include "MultiCouplingScheme.hpp"
 #include "acceleration/Acceleration.hpp"
+#include "com/Communication.hpp"
 #include "m2n/M2N.hpp"
 #include "m2n/SharedPointer.hpp"
 #include "math/math.hpp"
@@ -30,6 +31,7 @@ MultiCouplingScheme::MultiCouplingScheme(
     _receiveDataVector.push_back(receiveMap);
     _sendDataVector.push_back(sendMap);
   }
+  _receiveBuffers.resize(_communications.size());
 }
 
 void MultiCouplingScheme::initialize(
@@ -161,10 +163,17 @@ void MultiCouplingScheme::advance()
       getAcceleration()->performAcceleration(_allData);
     }
 
-    for (m2n::PtrM2N m2n : _communications) {
-      m2n->send(convergence);
-      PRECICE_ASSERT(not _isCoarseModelOptimizationActive);
-      m2n->send(_isCoarseModelOptimizationActive); //need to do this to match with ParallelCplScheme
+    // The flags are sent to all partners at once, as M2N::send(bool) does from the master.
+    PRECICE_ASSERT(not _isCoarseModelOptimizationActive);
+    std::vector<com::PtrRequest> requests;
+    if (not utils::MasterSlave::isSlave()) {
+      for (m2n::PtrM2N m2n : _communications) {
+        requests.push_back(m2n->getMasterCommunication()->aSend(convergence, 0));
+        requests.push_back(m2n->getMasterCommunication()->aSend(_isCoarseModelOptimizationActive, 0)); //need to do this to match with ParallelCplScheme
+      }
+    }
+    for (com::PtrRequest &request : requests) {
+      request->wait();
     }
 
     if (convergence && (getExtrapolationOrder() > 0)) {
@@ -246,12 +255,7 @@ void MultiCouplingScheme::sendData()
     PRECICE_ASSERT(_communications[i].get() != nullptr);
     PRECICE_ASSERT(_communications[i]->isConnected());
 
-    for (DataMap::value_type &pair : _sendDataVector[i]) {
-      int size = pair.second->values->size();
-      if (size > 0) {
-        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
-      }
-    }
+    sendPackedData(*_communications[i], _sendDataVector[i]);
   }
 }
 
@@ -259,16 +263,16 @@ void MultiCouplingScheme::receiveData()
 {
   PRECICE_TRACE();
 
+  // Receives from all partners are pending at the same time, hence waiting
+  // for the slowest partner overlaps with the transfers of all others.
   for (size_t i = 0; i < _communications.size(); i++) {
     PRECICE_ASSERT(_communications[i].get() != nullptr);
     PRECICE_ASSERT(_communications[i]->isConnected());
-
-    for (DataMap::value_type &pair : _receiveDataVector[i]) {
-      int size = pair.second->values->size();
-      if (size > 0) {
-        _communications[i]->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
-      }
-    }
+    startReceivePackedData(*_communications[i], _receiveDataVector[i], _receiveBuffers[i]);
+  }
+  for (size_t i = 0; i < _communications.size(); i++) {
+    _communications[i]->completeReceive();
+    unpackReceivedData(_receiveDataVector[i], _receiveBuffers[i]);
   }
 }
 
@@ -58,6 +58,9 @@ private:
 
   std::vector<DataMap> _receiveDataVector;
   std::vector<DataMap> _sendDataVector;
+
+  /// Receive buffers of the packed data per communication
+  std::vector<PackedBuffers> _receiveBuffers;
 };
 
 } // namespace cplscheme
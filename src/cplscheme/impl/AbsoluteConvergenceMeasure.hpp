@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cmath>
 #include "ConvergenceMeasure.hpp"
 #include "logging/Logger.hpp"
 #include "utils/MasterSlave.hpp"
@@ -42,12 +43,31 @@ public:
       const Eigen::VectorXd &newValues,
       const Eigen::VectorXd &designSpecification)
   {
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    measureFromSums(oldValues, newValues, designSpecification);
+  }
+
+  virtual int getSumCount() const
+  {
+    return 1;
+  }
+
+  /// Adds the squared two-norm of the differences.
+  virtual void addLocalSums(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues,
+      const Eigen::VectorXd &designSpecification,
+      double *               sums) const
+  {
+    for (int i = 0; i < newValues.size(); i++) {
+      const double diff = newValues(i) - oldValues(i) - designSpecification(i);
+      sums[0] += diff * diff;
+    }
+  }
+
+  virtual void completeMeasurement(const double *sums)
+  {
+    _normDiff      = std::sqrt(sums[0]);
     _isConvergence = _normDiff <= _convergenceLimit;
-    //      PRECICE_INFO("Absolute convergence measure: "
-    //                     << "two-norm differences = " << normDiff
-    //                     << ", convergence limit = " << _convergenceLimit
-    //                     << ", convergence = " << _isConvergence );
   }
 
   virtual bool isConvergence() const
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <vector>
+#include "utils/MasterSlave.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -18,6 +21,11 @@ namespace impl {
  * -# call newMeasurementSeries() for one set of iterations
  * -# call measure() for convergence measurement
  * -# retrieve the convergence status via isConvergence()
+ *
+ * Measures based on norms of distributed data can, in addition, split the
+ * measurement into local sums (addLocalSums()) and an evaluation of the sums over
+ * all ranks (completeMeasurement()). This allows to reduce the sums of several
+ * measures in a single collective operation.
  */
 class ConvergenceMeasure {
 public:
@@ -49,6 +57,48 @@ public:
   {
     return 0;
   }
+
+  /// Returns the amount of sums needed by the measurement, 0 if it is not split.
+  virtual int getSumCount() const
+  {
+    return 0;
+  }
+
+  /**
+   * @brief Adds the local contributions of this rank to the sums of a measurement.
+   *
+   * @param[in] oldValues Old iterate values.
+   * @param[in] newValues New iterate values.
+   * @param[in,out] sums Array of getSumCount() sums.
+   */
+  virtual void addLocalSums(
+      const Eigen::VectorXd & /*oldValues*/,
+      const Eigen::VectorXd & /*newValues*/,
+      const Eigen::VectorXd & /*designSpecification*/,
+      double * /*sums*/) const
+  {
+    PRECICE_ASSERT(getSumCount() == 0, "A measurement with sums has to add its local sums.");
+  }
+
+  /// Completes a measurement from the sums over all ranks, see addLocalSums().
+  virtual void completeMeasurement(const double * /*sums*/)
+  {
+    PRECICE_ASSERT(getSumCount() == 0, "A measurement with sums has to complete itself from them.");
+  }
+
+protected:
+  /// Performs a split measurement with a reduction of its own sums.
+  void measureFromSums(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues,
+      const Eigen::VectorXd &designSpecification)
+  {
+    std::vector<double> localSums(getSumCount(), 0.0);
+    std::vector<double> globalSums(localSums.size());
+    addLocalSums(oldValues, newValues, designSpecification, localSums.data());
+    utils::MasterSlave::allreduceSum(localSums.data(), globalSums.data(), localSums.size());
+    completeMeasurement(globalSums.data());
+  }
 };
 } // namespace impl
 } // namespace cplscheme
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cmath>
 #include "../CouplingData.hpp"
 #include "ConvergenceMeasure.hpp"
 #include "logging/Logger.hpp"
@@ -54,22 +55,34 @@ public:
       const Eigen::VectorXd &newValues,
       const Eigen::VectorXd &designSpecification)
   {
-    /*
-     std::cout<<"\n-------\n";
-     std::cout<<"   old val: \n"<<oldValues<<'\n';
-     std::cout<<"   new val: \n"<<newValues<<"\n\n";
-     std::cout<<"   design spec: \n"<<designSpecification<<"\n\n";
-     std::cout<<"-------\n\n";
-*/
-
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
-    _norm          = utils::MasterSlave::l2norm(newValues + designSpecification);
+    measureFromSums(oldValues, newValues, designSpecification);
+  }
+
+  virtual int getSumCount() const
+  {
+    return 2;
+  }
+
+  /// Adds the squared two-norms of the differences and of the new values.
+  virtual void addLocalSums(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues,
+      const Eigen::VectorXd &designSpecification,
+      double *               sums) const
+  {
+    for (int i = 0; i < newValues.size(); i++) {
+      const double diff  = newValues(i) - oldValues(i) - designSpecification(i);
+      const double value = newValues(i) + designSpecification(i);
+      sums[0] += diff * diff;
+      sums[1] += value * value;
+    }
+  }
+
+  virtual void completeMeasurement(const double *sums)
+  {
+    _normDiff      = std::sqrt(sums[0]);
+    _norm          = std::sqrt(sums[1]);
     _isConvergence = _normDiff <= _norm * _convergenceLimitPercent;
-    //      PRECICE_INFO("Relative convergence measure: "
-    //                    << "two-norm differences = " << normDiff
-    //                    << ", convergence limit = "
-    //                    << normNew * _convergenceLimitPercent
-    //                    << ", convergence = " << _isConvergence );
   }
 
   virtual bool isConvergence() const
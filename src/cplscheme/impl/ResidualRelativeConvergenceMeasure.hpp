@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cmath>
 #include <limits>
 #include "../CouplingData.hpp"
 #include "ConvergenceMeasure.hpp"
@@ -46,17 +47,35 @@ public:
       const Eigen::VectorXd &newValues,
       const Eigen::VectorXd &designSpecification)
   {
-    _normDiff = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    measureFromSums(oldValues, newValues, designSpecification);
+  }
+
+  virtual int getSumCount() const
+  {
+    return 1;
+  }
+
+  /// Adds the squared two-norm of the differences.
+  virtual void addLocalSums(
+      const Eigen::VectorXd &oldValues,
+      const Eigen::VectorXd &newValues,
+      const Eigen::VectorXd &designSpecification,
+      double *               sums) const
+  {
+    for (int i = 0; i < newValues.size(); i++) {
+      const double diff = newValues(i) - oldValues(i) - designSpecification(i);
+      sums[0] += diff * diff;
+    }
+  }
+
+  virtual void completeMeasurement(const double *sums)
+  {
+    _normDiff = std::sqrt(sums[0]);
     if (_isFirstIteration) {
       _normFirstResidual = _normDiff;
       _isFirstIteration  = false;
     }
     _isConvergence = _normDiff < _normFirstResidual * _convergenceLimitPercent;
-    //      PRECICE_INFO("Residual Relative convergence measure: "
-    //                    << "two-norm differences = " << normDiff
-    //                    << ", convergence limit = "
-    //                    << _normFirstResidual * _convergenceLimitPercent
-    //                    << ", convergence = " << _isConvergence );
   }
 
   virtual bool isConvergence() const
@@ -26,4 +26,25 @@ BOOST_AUTO_TEST_CASE(RelativeConvergenceMeasureTest)
   BOOST_TEST(measure.isConvergence());
 }
 
+BOOST_AUTO_TEST_CASE(RelativeConvergenceMeasureFromSums)
+{
+  precice::cplscheme::impl::RelativeConvergenceMeasure measure(0.1);
+  precice::cplscheme::impl::RelativeConvergenceMeasure reference(0.1);
+  BOOST_TEST(measure.getSumCount() == 2);
+
+  // The sums of two parts of the data lead to the same result as the whole data
+  Eigen::VectorXd oldValues(4), newValues(4), designSpec(4);
+  oldValues << 1.0, 2.0, 2.9, 3.0;
+  newValues << 1.05, 2.1, 3.0, 3.0;
+  designSpec << 0.0, 0.1, 0.0, 0.0;
+  double sums[2] = {0.0, 0.0};
+  measure.addLocalSums(oldValues.head(2), newValues.head(2), designSpec.head(2), sums);
+  measure.addLocalSums(oldValues.tail(2), newValues.tail(2), designSpec.tail(2), sums);
+  measure.completeMeasurement(sums);
+
+  reference.measure(oldValues, newValues, designSpec);
+  BOOST_TEST(measure.isConvergence() == reference.isConvergence());
+  BOOST_TEST(measure.getNormResidual() == reference.getNormResidual());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -32,6 +32,9 @@ public:
       const std::string &name,
       const std::string &location,
       mesh::Mesh &       mesh) = 0;
+
+  /// Blocks until all pending exports are written.
+  virtual void flush() {}
 };
 
 } // namespace io
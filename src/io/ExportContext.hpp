@@ -29,6 +29,12 @@ struct ExportContext {
   // @brief If true, normals are plotted.
   bool plotNormals;
 
+  // @brief If true, data arrays are written as binary data (VTKXML only).
+  bool binary;
+
+  // @brief If true, files are written in a background thread (VTKXML only).
+  bool asynchronous;
+
   /**
    * @brief Constructor.
    */
@@ -39,7 +45,9 @@ struct ExportContext {
         triggerSolverPlot(false),
         everyIteration(false),
         type(),
-        plotNormals(false) {}
+        plotNormals(false),
+        binary(false),
+        asynchronous(false) {}
 };
 
 } // namespace io
@@ -3,6 +3,7 @@
 #include <boost/filesystem.hpp>
 #include <fstream>
 #include <string>
+#include <utility>
 #include "Constants.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
@@ -15,12 +16,103 @@
 namespace precice {
 namespace io {
 
+namespace {
+
+/**
+ * @brief Writes the DataArray elements of a vtu file.
+ *
+ * In ASCII mode, the values are written inline. In binary mode, only the
+ * element is written and the values are appended by writeAppendedData(),
+ * each block prefixed by its size in bytes.
+ */
+class DataArrayWriter {
+public:
+  DataArrayWriter(std::ostream &out, bool binary)
+      : _out(out),
+        _binary(binary)
+  {
+  }
+
+  template <typename T>
+  void write(
+      const std::string &   type,
+      const std::string &   name,
+      int                   components,
+      const std::vector<T> &values)
+  {
+    _out << "            <DataArray type=\"" << type << "\" Name=\"" << name << "\" NumberOfComponents=\"" << components << "\" ";
+    if (_binary) {
+      const std::size_t bytes = sizeof(T) * values.size();
+      _out << "format=\"appended\" offset=\"" << _offset << "\"/>\n";
+      _blocks.emplace_back(reinterpret_cast<const char *>(values.data()), bytes);
+      _offset += sizeof(std::uint32_t) + bytes;
+      return;
+    }
+    _out << "format=\"ascii\">\n";
+    _out << "               ";
+    for (const T &value : values) {
+      _out << +value << ' ';
+    }
+    _out << '\n';
+    _out << "            </DataArray>\n";
+  }
+
+  /// Writes the AppendedData element, if there is any.
+  void writeAppendedData()
+  {
+    if (_blocks.empty()) {
+      return;
+    }
+    _out << "   <AppendedData encoding=\"raw\">\n   _";
+    for (const auto &block : _blocks) {
+      const std::uint32_t size = block.second;
+      _out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+      _out.write(block.first, block.second);
+    }
+    _out << "\n   </AppendedData>\n";
+  }
+
+private:
+  std::ostream &_out;
+
+  bool _binary;
+
+  /// Offset of the next block in the appended data
+  std::size_t _offset = 0;
+
+  /// Blocks of the appended data as pairs of data and size in bytes
+  std::vector<std::pair<const char *, std::size_t>> _blocks;
+};
+
+} // namespace
+
 ExportVTKXML::ExportVTKXML(
-    bool writeNormals)
+    bool writeNormals,
+    bool binary,
+    bool asynchronous)
     : Export(),
       _writeNormals(writeNormals),
-      _meshDimensions(-1)
+      _binary(binary),
+      _asynchronous(asynchronous)
 {
+  if (_asynchronous) {
+    _worker = std::thread(&ExportVTKXML::runWorker, this);
+  }
+}
+
+ExportVTKXML::~ExportVTKXML()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _condition.notify_all();
+  if (_worker.joinable()) {
+    _worker.join();
+  }
+  if (not _error.empty()) {
+    PRECICE_WARN(_error);
+  }
 }
 
 int ExportVTKXML::getType() const
@@ -35,48 +127,191 @@ void ExportVTKXML::doExport(
 {
   PRECICE_TRACE(name, location, mesh.getName());
   PRECICE_ASSERT(utils::MasterSlave::isSlave() || utils::MasterSlave::isMaster());
-  processDataNamesAndDimensions(mesh);
   if (not location.empty())
     boost::filesystem::create_directories(location);
-  if (utils::MasterSlave::isMaster()) {
-    writeMasterFile(name, location, mesh);
+
+  if (not _asynchronous) {
+    Snapshot snapshot;
+    takeSnapshot(name, location, mesh, snapshot);
+    const std::string error = write(snapshot);
+    PRECICE_CHECK(error.empty(), error);
+    return;
   }
-  if (mesh.vertices().size() > 0) { //only procs at the coupling interface should write output (for performance reasons)
-    writeSubFile(name, location, mesh);
+
+  std::unique_ptr<Snapshot> snapshot;
+  std::string               error;
+  {
+    // Wait until the worker took the previous snapshot, so at most two exports are in flight.
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [this] { return not _pending; });
+    snapshot = std::move(_spare);
+    error.swap(_error);
+  }
+  PRECICE_CHECK(error.empty(), error);
+  if (not snapshot) {
+    snapshot.reset(new Snapshot);
   }
+  takeSnapshot(name, location, mesh, *snapshot);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending = std::move(snapshot);
+  }
+  _condition.notify_all();
 }
 
-void ExportVTKXML::processDataNamesAndDimensions(mesh::Mesh const &mesh)
+void ExportVTKXML::flush()
 {
-  _meshDimensions = mesh.getDimensions();
-  _vectorDataNames.clear();
-  _scalarDataNames.clear();
-  if (_writeNormals) {
-    _vectorDataNames.push_back("VertexNormals");
+  std::string error;
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [this] { return not _pending && not _busy; });
+    error.swap(_error);
   }
-  for (mesh::PtrData data : mesh.data()) {
-    int dataDimensions = data->getDimensions();
-    PRECICE_ASSERT(dataDimensions >= 1);
-    std::string dataName = data->getName();
-    if (dataDimensions == 1) {
-      _scalarDataNames.push_back(dataName);
-    } else {
-      _vectorDataNames.push_back(dataName);
+  PRECICE_CHECK(error.empty(), error);
+}
+
+void ExportVTKXML::runWorker()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _condition.wait(lock, [this] { return _pending || _stop; });
+    if (not _pending) {
+      return;
     }
+    std::unique_ptr<Snapshot> snapshot = std::move(_pending);
+    _busy                              = true;
+    lock.unlock();
+    _condition.notify_all();
+
+    std::string error = write(*snapshot);
+
+    lock.lock();
+    if (_error.empty()) {
+      _error = std::move(error);
+    }
+    _spare = std::move(snapshot);
+    _busy  = false;
+    _condition.notify_all();
   }
 }
 
-void ExportVTKXML::writeMasterFile(
+void ExportVTKXML::takeSnapshot(
     const std::string &name,
     const std::string &location,
-    mesh::Mesh &       mesh)
+    mesh::Mesh &       mesh,
+    Snapshot &         snapshot) const
+{
+  const int dimensions   = mesh.getDimensions();
+  snapshot.name          = name;
+  snapshot.location      = location;
+  snapshot.rank          = utils::MasterSlave::getRank();
+  snapshot.hasMasterFile = utils::MasterSlave::isMaster();
+  snapshot.hasSubFile    = mesh.vertices().size() > 0; //only procs at the coupling interface should write output (for performance reasons)
+
+  snapshot.pieces.clear();
+  if (snapshot.hasMasterFile) {
+    for (int i = 0; i < utils::MasterSlave::getSize(); i++) {
+      if (mesh.getVertexDistribution()[i].size() > 0) { //only non-empty subfiles
+        snapshot.pieces.push_back(i);
+      }
+    }
+  }
+
+  // Data arrays always have three components, also for 2D scenarios
+  snapshot.positions.clear();
+  snapshot.positions.reserve(3 * mesh.vertices().size());
+  for (const mesh::Vertex &vertex : mesh.vertices()) {
+    const Eigen::VectorXd &coords = vertex.getCoords();
+    for (int i = 0; i < 3; i++) {
+      snapshot.positions.push_back(i < dimensions ? coords(i) : 0.0);
+    }
+  }
+
+  snapshot.connectivity.clear();
+  snapshot.offsets.clear();
+  snapshot.types.clear();
+  if (dimensions == 2) { // write edges as cells
+    for (const mesh::Edge &edge : mesh.edges()) {
+      snapshot.connectivity.push_back(edge.vertex(0).getID());
+      snapshot.connectivity.push_back(edge.vertex(1).getID());
+      snapshot.offsets.push_back(snapshot.connectivity.size());
+      snapshot.types.push_back(3);
+    }
+  } else { // write triangles and quads as cells
+    for (const mesh::Triangle &triangle : mesh.triangles()) {
+      for (int i = 0; i < 3; i++) {
+        snapshot.connectivity.push_back(triangle.vertex(i).getID());
+      }
+      snapshot.offsets.push_back(snapshot.connectivity.size());
+      snapshot.types.push_back(5);
+    }
+    for (const mesh::Quad &quad : mesh.quads()) {
+      for (int i = 0; i < 4; i++) {
+        snapshot.connectivity.push_back(quad.vertex(i).getID());
+      }
+      snapshot.offsets.push_back(snapshot.connectivity.size());
+      snapshot.types.push_back(9);
+    }
+  }
+
+  const std::size_t fieldCount = mesh.data().size() + (_writeNormals ? 1 : 0);
+  snapshot.fields.resize(fieldCount);
+  auto field = snapshot.fields.begin();
+  if (_writeNormals) {
+    field->name       = "VertexNormals";
+    field->components = 3;
+    field->values.clear();
+    field->values.reserve(3 * mesh.vertices().size());
+    for (const mesh::Vertex &vertex : mesh.vertices()) {
+      const Eigen::VectorXd &normal = vertex.getNormal();
+      for (int i = 0; i < 3; i++) {
+        field->values.push_back(i < dimensions ? normal(i) : 0.0);
+      }
+    }
+    ++field;
+  }
+  for (mesh::PtrData data : mesh.data()) { // Plot vertex data
+    const Eigen::VectorXd &values         = data->values();
+    const int              dataDimensions = data->getDimensions();
+    PRECICE_ASSERT(dataDimensions >= 1);
+    field->name       = data->getName();
+    field->components = (dataDimensions == 2) ? 3 : dataDimensions; //2D data needs to be 3D for vtk
+    field->values.clear();
+    field->values.reserve(field->components * mesh.vertices().size());
+    for (size_t count = 0; count < mesh.vertices().size(); count++) {
+      const size_t offset = count * dataDimensions;
+      for (int i = 0; i < field->components; i++) {
+        field->values.push_back(i < dataDimensions ? values(offset + i) : 0.0);
+      }
+    }
+    ++field;
+  }
+}
+
+std::string ExportVTKXML::write(const Snapshot &snapshot) const
+{
+  std::string error;
+  if (snapshot.hasMasterFile) {
+    error = writeMasterFile(snapshot);
+  }
+  if (error.empty() && snapshot.hasSubFile) {
+    error = writeSubFile(snapshot);
+  }
+  return error;
+}
+
+std::string ExportVTKXML::writeMasterFile(const Snapshot &snapshot) const
 {
   namespace fs = boost::filesystem;
-  fs::path outfile(location);
-  outfile = outfile / fs::path(name + "_master.pvtu");
+  fs::path outfile(snapshot.location);
+  outfile = outfile / fs::path(snapshot.name + "_master.pvtu");
   std::ofstream outMasterFile(outfile.string(), std::ios::trunc);
 
-  PRECICE_CHECK(outMasterFile, "Could not open master file \"" << outfile.c_str() << "\" for VTKXML export!");
+  if (not outMasterFile) {
+    return "Could not open master file \"" + outfile.string() + "\" for VTKXML export!";
+  }
+
+  const char *floatType = _binary ? "Float64" : "Float32";
 
   outMasterFile << "<?xml version=\"1.0\"?>\n";
   outMasterFile << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"";
@@ -84,7 +319,7 @@ void ExportVTKXML::writeMasterFile(
   outMasterFile << "   <PUnstructuredGrid GhostLevel=\"0\">\n";
 
   outMasterFile << "      <PPoints>\n";
-  outMasterFile << "         <PDataArray type=\"Float32\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\"/>\n";
+  outMasterFile << "         <PDataArray type=\"" << floatType << "\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\"/>\n";
   outMasterFile << "      </PPoints>\n";
 
   outMasterFile << "      <PCells>\n";
@@ -95,256 +330,100 @@ void ExportVTKXML::writeMasterFile(
 
   // write scalar data names
   outMasterFile << "      <PPointData Scalars=\"";
-  for (size_t i = 0; i < _scalarDataNames.size(); ++i) {
-    outMasterFile << _scalarDataNames[i] << ' ';
+  for (const Field &field : snapshot.fields) {
+    if (field.components == 1) {
+      outMasterFile << field.name << ' ';
+    }
   }
   // write vector data names
   outMasterFile << "\" Vectors=\"";
-  for (size_t i = 0; i < _vectorDataNames.size(); ++i) {
-    outMasterFile << _vectorDataNames[i] << ' ';
+  for (const Field &field : snapshot.fields) {
+    if (field.components > 1) {
+      outMasterFile << field.name << ' ';
+    }
   }
   outMasterFile << "\">\n";
 
-  for (size_t i = 0; i < _scalarDataNames.size(); ++i) {
-    outMasterFile << "         <PDataArray type=\"Float32\" Name=\"" << _scalarDataNames[i] << "\" NumberOfComponents=\"" << 1 << "\"/>\n";
-  }
-
-  for (size_t i = 0; i < _vectorDataNames.size(); ++i) {
-    outMasterFile << "         <PDataArray type=\"Float32\" Name=\"" << _vectorDataNames[i] << "\" NumberOfComponents=\"" << 3 << "\"/>\n";
+  for (const Field &field : snapshot.fields) {
+    outMasterFile << "         <PDataArray type=\"" << floatType << "\" Name=\"" << field.name << "\" NumberOfComponents=\"" << field.components << "\"/>\n";
   }
   outMasterFile << "      </PPointData>\n";
 
-  for (int i = 0; i < utils::MasterSlave::getSize(); i++) {
-    if (mesh.getVertexDistribution()[i].size() > 0) { //only non-empty subfiles
-      outMasterFile << "      <Piece Source=\"" << name << "_r" << i << ".vtu\"/>\n";
-    }
+  for (int rank : snapshot.pieces) {
+    outMasterFile << "      <Piece Source=\"" << snapshot.name << "_r" << rank << ".vtu\"/>\n";
   }
 
   outMasterFile << "   </PUnstructuredGrid>\n";
   outMasterFile << "</VTKFile>\n";
 
   outMasterFile.close();
+  return {};
 }
 
-void ExportVTKXML::writeSubFile(
-    const std::string &name,
-    const std::string &location,
-    mesh::Mesh &       mesh)
+std::string ExportVTKXML::writeSubFile(const Snapshot &snapshot) const
 {
-  int numPoints = mesh.vertices().size(); // number of vertices
-  int numCells;                           // number of cells
-  if (_meshDimensions == 2) {
-    numCells = mesh.edges().size();
-  } else {
-    numCells = mesh.triangles().size() + mesh.quads().size();
-  }
+  const size_t numPoints = snapshot.positions.size() / 3; // number of vertices
+  const size_t numCells  = snapshot.types.size();         // number of cells
 
   namespace fs = boost::filesystem;
-  fs::path outfile(location);
-  outfile = outfile / fs::path(name + "_r" + std::to_string(utils::MasterSlave::getRank()) + ".vtu");
-  std::ofstream outSubFile(outfile.string(), std::ios::trunc);
+  fs::path outfile(snapshot.location);
+  outfile = outfile / fs::path(snapshot.name + "_r" + std::to_string(snapshot.rank) + ".vtu");
+  std::ofstream outSubFile(outfile.string(), std::ios::trunc | std::ios::binary);
 
-  PRECICE_CHECK(outSubFile, "Could not open slave file \"" << outfile.c_str() << "\" for VTKXML export!");
+  if (not outSubFile) {
+    return "Could not open slave file \"" + outfile.string() + "\" for VTKXML export!";
+  }
+
+  const char *    floatType = _binary ? "Float64" : "Float32";
+  DataArrayWriter writer(outSubFile, _binary);
 
   outSubFile << "<?xml version=\"1.0\"?>\n";
   outSubFile << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">") << '\n';
+  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\"" : "LittleEndian\"");
+  if (_binary) {
+    outSubFile << " header_type=\"UInt32\"";
+  }
+  outSubFile << ">\n";
 
   outSubFile << "   <UnstructuredGrid>\n";
   outSubFile << "      <Piece NumberOfPoints=\"" << numPoints << "\" NumberOfCells=\"" << numCells << "\"> \n";
   outSubFile << "         <Points> \n";
-  outSubFile << "            <DataArray type=\"Float32\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\" format=\"ascii\"> \n";
-  for (const mesh::Vertex &vertex : mesh.vertices()) {
-    writeVertex(vertex.getCoords(), outSubFile);
-  }
-  outSubFile << "            </DataArray>\n";
+  writer.write(floatType, "Position", 3, snapshot.positions);
   outSubFile << "         </Points> \n\n";
 
   // Write Mesh
-  exportMesh(outSubFile, mesh);
+  outSubFile << "         <Cells>\n";
+  writer.write("Int32", "connectivity", 1, snapshot.connectivity);
+  writer.write("Int32", "offsets", 1, snapshot.offsets);
+  writer.write("UInt8", "types", 1, snapshot.types);
+  outSubFile << "         </Cells>\n";
 
   // Write data
-  exportData(outSubFile, mesh);
-
-  outSubFile << "      </Piece>\n";
-  outSubFile << "   </UnstructuredGrid> \n";
-  outSubFile << "</VTKFile>\n";
-
-  outSubFile.close();
-}
-
-void ExportVTKXML::exportMesh(
-    std::ofstream &   outFile,
-    mesh::Mesh const &mesh)
-{
-  if (_meshDimensions == 2) { // write edges as cells
-    outFile << "         <Cells>\n";
-    outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-    outFile << "               ";
-    for (const mesh::Edge &edge : mesh.edges()) {
-      writeLine(edge, outFile);
-    }
-    outFile << '\n';
-    outFile << "            </DataArray> \n";
-    outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.edges().size(); i++) {
-      outFile << 2 * i << "  ";
-    }
-    outFile << '\n';
-    outFile << "            </DataArray>\n";
-    outFile << "            <DataArray type=\"UInt8\"  Name=\"types\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.edges().size(); i++) {
-      outFile << 3 << "  ";
-    }
-    outFile << '\n';
-    outFile << "            </DataArray>\n";
-    outFile << "         </Cells>\n";
-  } else { // write triangles and quads as cells
-
-    outFile << "         <Cells>\n";
-    outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-    outFile << "               ";
-    for (const mesh::Triangle &triangle : mesh.triangles()) {
-      writeTriangle(triangle, outFile);
+  outSubFile << "         <PointData Scalars=\"";
+  for (const Field &field : snapshot.fields) {
+    if (field.components == 1) {
+      outSubFile << field.name << ' ';
     }
-    for (const mesh::Quad &quad : mesh.quads()) {
-      writeQuadrangle(quad, outFile);
-    }
-    outFile << '\n';
-    outFile << "            </DataArray> \n";
-    outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-      outFile << 3 * i << "  ";
-    }
-    for (size_t i = 1; i <= mesh.quads().size(); i++) {
-      outFile << 4 * i << "  ";
-    }
-    outFile << '\n';
-    outFile << "            </DataArray>\n";
-    outFile << "            <DataArray type=\"UInt8\"  Name=\"types\" NumberOfComponents=\"1\" format=\"ascii\">\n";
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-      outFile << 5 << "  ";
-    }
-    for (size_t i = 1; i <= mesh.quads().size(); i++) {
-      outFile << 9 << "  ";
-    }
-    outFile << '\n';
-    outFile << "            </DataArray>\n";
-    outFile << "         </Cells>\n";
   }
-}
-
-void ExportVTKXML::exportData(
-    std::ofstream &outFile,
-    mesh::Mesh &   mesh)
-{
-  outFile << "         <PointData Scalars=\"";
-  for (size_t i = 0; i < _scalarDataNames.size(); i++) {
-    outFile << _scalarDataNames[i] << ' ';
-  }
-  outFile << "\" Vectors=\"";
-  for (size_t i = 0; i < _vectorDataNames.size(); i++) {
-    outFile << _vectorDataNames[i] << ' ';
-  }
-  outFile << "\">\n";
-
-  // Print VertexNormals
-  if (_writeNormals) {
-    const auto dimensions = mesh.getDimensions();
-    outFile << "            <DataArray type=\"Float32\" Name=\"VertexNormals\" NumberOfComponents=\"";
-    outFile << std::max(3, dimensions) << "\" format=\"ascii\">\n";
-    outFile << "               ";
-    for (const auto &vertex : mesh.vertices()) {
-      const auto normal = vertex.getNormal();
-      for (int i = 0; i < std::max(3, dimensions); i++) {
-        if (i < dimensions) {
-          outFile << normal[i] << ' ';
-        } else {
-          outFile << "0.0 ";
-        }
-        outFile << ' ';
-      }
-    }
-    outFile << '\n'
-            << "            </DataArray>\n";
-  }
-  for (mesh::PtrData data : mesh.data()) { // Plot vertex data
-    Eigen::VectorXd &values         = data->values();
-    int              dataDimensions = data->getDimensions();
-    std::string      dataName(data->getName());
-    int              numberOfComponents = (dataDimensions == 2) ? 3 : dataDimensions;
-    outFile << "            <DataArray type=\"Float32\" Name=\"" << dataName << "\" NumberOfComponents=\"" << numberOfComponents;
-    outFile << "\" format=\"ascii\">\n";
-    outFile << "               ";
-    if (dataDimensions > 1) {
-      Eigen::VectorXd viewTemp(dataDimensions);
-      for (size_t count = 0; count < mesh.vertices().size(); count++) {
-        size_t offset = count * dataDimensions;
-        for (int i = 0; i < dataDimensions; i++) {
-          viewTemp[i] = values(offset + i);
-        }
-        for (int i = 0; i < dataDimensions; i++) {
-          outFile << viewTemp[i] << ' ';
-        }
-        if (dataDimensions == 2) {
-          outFile << "0.0" << ' '; //2D data needs to be 3D for vtk
-        }
-        outFile << ' ';
-      }
-    } else if (dataDimensions == 1) {
-      for (size_t count = 0; count < mesh.vertices().size(); count++) {
-        outFile << values(count) << ' ';
-      }
+  outSubFile << "\" Vectors=\"";
+  for (const Field &field : snapshot.fields) {
+    if (field.components > 1) {
+      outSubFile << field.name << ' ';
     }
-    outFile << '\n'
-            << "            </DataArray>\n";
   }
-  outFile << "         </PointData> \n";
-}
-
-void ExportVTKXML::writeVertex(
-    const Eigen::VectorXd &position,
-    std::ofstream &        outFile)
-{
-  outFile << "               ";
-  for (int i = 0; i < position.size(); i++) {
-    outFile << position(i) << "  ";
+  outSubFile << "\">\n";
+  for (const Field &field : snapshot.fields) {
+    writer.write(floatType, field.name, field.components, field.values);
   }
-  if (position.size() == 2) {
-    outFile << 0.0 << "  "; //also for 2D scenario, vtk needs 3D data
-  }
-  outFile << '\n';
-}
+  outSubFile << "         </PointData> \n";
 
-void ExportVTKXML::writeTriangle(
-    const mesh::Triangle &triangle,
-    std::ofstream &       outFile)
-{
-  outFile << triangle.vertex(0).getID() << "  ";
-  outFile << triangle.vertex(1).getID() << "  ";
-  outFile << triangle.vertex(2).getID() << "  ";
-}
-
-void ExportVTKXML::writeQuadrangle(
-    const mesh::Quad &quad,
-    std::ofstream &   outFile)
-{
-  outFile << quad.vertex(0).getID() << "  ";
-  outFile << quad.vertex(1).getID() << "  ";
-  outFile << quad.vertex(2).getID() << "  ";
-  outFile << quad.vertex(3).getID() << "  ";
-}
+  outSubFile << "      </Piece>\n";
+  outSubFile << "   </UnstructuredGrid> \n";
+  writer.writeAppendedData();
+  outSubFile << "</VTKFile>\n";
 
-void ExportVTKXML::writeLine(
-    const mesh::Edge &edge,
-    std::ofstream &   outFile)
-{
-  outFile << edge.vertex(0).getID() << "  ";
-  outFile << edge.vertex(1).getID() << "  ";
+  outSubFile.close();
+  return {};
 }
 
 } // namespace io
@@ -1,7 +1,11 @@
 #pragma once
 
-#include <Eigen/Core>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include "Export.hpp"
 #include "logging/Logger.hpp"
@@ -9,24 +13,33 @@
 namespace precice {
 namespace mesh {
 class Mesh;
-class Quad;
-class Edge;
-class Triangle;
 } // namespace mesh
 } // namespace precice
 
 namespace precice {
 namespace io {
 
-/// Writes meshes to xml-vtk files. Only for parallel usage. Serial usage (coupling mode) should still use ExportVTK
+/**
+ * @brief Writes meshes to xml-vtk files. Only for parallel usage. Serial usage (coupling mode) should still use ExportVTK
+ *
+ * Data arrays are either written inline as ASCII or as raw binary data appended
+ * to the file. For asynchronous exports, doExport() copies the mesh into a
+ * snapshot, which a worker thread writes while the solver continues. If the
+ * worker falls behind by more than one export, doExport() waits for it.
+ */
 class ExportVTKXML : public Export {
 public:
   /**
    * @brief Standard constructor
    *
    * @param[in] writeNormals write normals to file?
+   * @param[in] binary write data arrays as appended raw binary data instead of ASCII?
+   * @param[in] asynchronous write files in a background thread?
    */
-  ExportVTKXML(bool writeNormals);
+  ExportVTKXML(bool writeNormals, bool binary = false, bool asynchronous = false);
+
+  /// Waits for pending exports to be written.
+  virtual ~ExportVTKXML();
 
   /// Returns the VTK type ID.
   virtual int getType() const;
@@ -42,66 +55,107 @@ public:
       const std::string &location,
       mesh::Mesh &       mesh);
 
-  static void writeVertex(
-      const Eigen::VectorXd &position,
-      std::ofstream &        outFile);
+  /// Blocks until all pending exports are written.
+  virtual void flush();
+
+private:
+  /// Values of one data array, padded to the number of components of the file.
+  struct Field {
+    std::string         name;
+    int                 components;
+    std::vector<double> values;
+  };
 
-  static void writeLine(
-      const mesh::Edge &edge,
-      std::ofstream &   outFile);
+  /// Copy of everything written for one export, independent of the mesh.
+  struct Snapshot {
+    std::string name;
+    std::string location;
+    int         rank;
+    bool        hasMasterFile;
+    bool        hasSubFile;
 
-  static void writeTriangle(
-      const mesh::Triangle &triangle,
-      std::ofstream &       outFile);
+    /// Ranks with non-empty sub files, only filled if hasMasterFile is set.
+    std::vector<int> pieces;
 
-  static void writeQuadrangle(
-      const mesh::Quad &quad,
-      std::ofstream &   outFile);
+    /// Coordinates of all vertices, padded to three components.
+    std::vector<double> positions;
 
-private:
-  logging::Logger _log{"io::ExportVTKXML"};
+    std::vector<int>          connectivity;
+    std::vector<int>          offsets;
+    std::vector<std::uint8_t> types;
+
+    /// Vertex normals (if written) and all data of the mesh.
+    std::vector<Field> fields;
+  };
+
+  mutable logging::Logger _log{"io::ExportVTKXML"};
 
   /// By default set true: plot vertex normals, false: no normals plotting
   bool _writeNormals;
 
-  /// dimensions of mesh
-  int _meshDimensions;
+  /// True: data arrays are appended as raw binary data, false: data arrays are written as ASCII
+  bool _binary;
+
+  /// True, if files are written by the worker thread
+  bool _asynchronous;
+
+  /// Thread writing the snapshots of asynchronous exports.
+  std::thread _worker;
 
-  /// List of names of all scalar data on mesh
-  std::vector<std::string> _scalarDataNames;
+  /// Protects the members below, which are shared with the worker.
+  std::mutex _mutex;
 
-  /// List of names of all vector data on mesh
-  std::vector<std::string> _vectorDataNames;
+  /// Signals changes of the members below.
+  std::condition_variable _condition;
+
+  /// Snapshot waiting to be written by the worker.
+  std::unique_ptr<Snapshot> _pending;
+
+  /// Snapshot of the last written export, which is reused to avoid allocations.
+  std::unique_ptr<Snapshot> _spare;
+
+  /// True, while the worker writes a snapshot.
+  bool _busy = false;
+
+  /// Signals the worker to finish after writing the pending snapshot.
+  bool _stop = false;
+
+  /// First error of the worker, reported by the next call of doExport() or flush().
+  std::string _error;
+
+  /// Copies everything written for one export from the mesh to the snapshot.
+  void takeSnapshot(
+      const std::string &name,
+      const std::string &location,
+      mesh::Mesh &       mesh,
+      Snapshot &         snapshot) const;
 
   /**
-    * @brief Stores scalar and vector data names in string vectors
-    * Needed for writing master file and sub files
-    */
-  void processDataNamesAndDimensions(mesh::Mesh const &mesh);
+   * @brief Writes the files of a snapshot.
+   *
+   * As this runs on the worker for asynchronous exports, errors are returned
+   * instead of reported.
+   *
+   * @return error message, empty on success
+   */
+  std::string write(const Snapshot &snapshot) const;
+
+  /// Writes the snapshots handed over by doExport() until _stop is set.
+  void runWorker();
 
   /**
     * @brief Writes the master file (called only by the master rank)
+    *
+    * @return error message, empty on success
     */
-  void writeMasterFile(
-      const std::string &name,
-      const std::string &location,
-      mesh::Mesh &       mesh);
+  std::string writeMasterFile(const Snapshot &snapshot) const;
 
   /**
     * @brief Writes the sub file for each rank
+    *
+    * @return error message, empty on success
     */
-  void writeSubFile(
-      const std::string &name,
-      const std::string &location,
-      mesh::Mesh &       mesh);
-
-  void exportMesh(
-      std::ofstream &   outFile,
-      mesh::Mesh const &mesh);
-
-  void exportData(
-      std::ofstream &outFile,
-      mesh::Mesh &   mesh);
+  std::string writeSubFile(const Snapshot &snapshot) const;
 };
 
 } // namespace io
@@ -35,12 +35,22 @@ ExportConfiguration::ExportConfiguration(xml::XMLTag &parent)
   auto attrEveryIteration = makeXMLAttribute(ATTR_EVERY_ITERATION, false)
                                 .setDocumentation("Exports in every coupling (sub)iteration. For debug purposes.");
 
+  auto attrBinary = makeXMLAttribute(ATTR_BINARY, false)
+                        .setDocumentation("If set to on/yes, data arrays are appended as raw binary data instead of ASCII text. "
+                                          "Only applies to the VTU files written by parallel participants.");
+
+  auto attrAsynchronous = makeXMLAttribute(ATTR_ASYNCHRONOUS, false)
+                              .setDocumentation("If set to on/yes, the mesh is copied and written in a background thread, "
+                                                "while the solver continues. Only applies to the VTU files written by parallel participants.");
+
   for (XMLTag &tag : tags) {
     tag.addAttribute(attrLocation);
     tag.addAttribute(attrEveryNTimeWindows);
     tag.addAttribute(attrTriggerSolver);
     tag.addAttribute(attrNormals);
     tag.addAttribute(attrEveryIteration);
+    tag.addAttribute(attrBinary);
+    tag.addAttribute(attrAsynchronous);
     parent.addSubtag(tag);
   }
 }
@@ -56,6 +66,8 @@ void ExportConfiguration::xmlTagCallback(
     context.everyNTimeWindows = tag.getIntAttributeValue(ATTR_EVERY_N_TIME_WINDOWS);
     context.plotNormals       = tag.getBooleanAttributeValue(ATTR_NORMALS);
     context.everyIteration    = tag.getBooleanAttributeValue(ATTR_EVERY_ITERATION);
+    context.binary            = tag.getBooleanAttributeValue(ATTR_BINARY);
+    context.asynchronous      = tag.getBooleanAttributeValue(ATTR_ASYNCHRONOUS);
     context.type              = tag.getName();
     _contexts.push_back(context);
   }
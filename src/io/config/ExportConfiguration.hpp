@@ -49,6 +49,8 @@ private:
   const std::string ATTR_TRIGGER_SOLVER       = "trigger-solver";
   const std::string ATTR_NORMALS              = "normals";
   const std::string ATTR_EVERY_ITERATION      = "every-iteration";
+  const std::string ATTR_BINARY               = "binary";
+  const std::string ATTR_ASYNCHRONOUS         = "asynchronous";
 
   std::list<ExportContext> _contexts;
 };
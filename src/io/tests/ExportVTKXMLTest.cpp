@@ -1,7 +1,14 @@
 #ifndef PRECICE_NO_MPI
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
 #include "com/MPIDirectCommunication.hpp"
 #include "io/ExportVTKXML.hpp"
+#include "mesh/Data.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Triangle.hpp"
@@ -165,6 +172,94 @@ BOOST_AUTO_TEST_CASE(ExportTriangulatedMesh)
   exportVTKXML.doExport(filename, location, mesh);
 }
 
+BOOST_AUTO_TEST_CASE(ExportTriangulatedMeshBinaryAsynchronous)
+{
+  int        dim           = 3;
+  bool       invertNormals = false;
+  mesh::Mesh mesh("MyMesh", dim, invertNormals, testing::nextMeshID());
+  mesh.createData("ScalarData", 1);
+  mesh.createData("VectorData", dim);
+
+  if (utils::Parallel::getProcessRank() == 0) {
+    mesh::Vertex &  v1      = mesh.createVertex(Eigen::VectorXd::Zero(dim));
+    mesh::Vertex &  v2      = mesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+    Eigen::VectorXd coords3 = Eigen::VectorXd::Zero(dim);
+    coords3[0]              = 1.0;
+    mesh::Vertex &v3        = mesh.createVertex(coords3);
+
+    mesh::Edge &e1 = mesh.createEdge(v1, v2);
+    mesh::Edge &e2 = mesh.createEdge(v2, v3);
+    mesh::Edge &e3 = mesh.createEdge(v3, v1);
+    mesh.createTriangle(e1, e2, e3);
+
+    mesh.getVertexDistribution()[0] = {0, 1, 2};
+    mesh.getVertexDistribution()[1] = {};
+    mesh.getVertexDistribution()[2] = {3, 4, 5};
+    mesh.getVertexDistribution()[3] = {6};
+  } else if (utils::Parallel::getProcessRank() == 1) {
+
+  } else if (utils::Parallel::getProcessRank() == 2) {
+    mesh::Vertex &  v1      = mesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+    mesh::Vertex &  v2      = mesh.createVertex(Eigen::VectorXd::Constant(dim, 2));
+    Eigen::VectorXd coords3 = Eigen::VectorXd::Zero(dim);
+    coords3[1]              = 1.0;
+    mesh::Vertex &v3        = mesh.createVertex(coords3);
+
+    mesh::Edge &e1 = mesh.createEdge(v1, v2);
+    mesh::Edge &e2 = mesh.createEdge(v2, v3);
+    mesh::Edge &e3 = mesh.createEdge(v3, v1);
+    mesh.createTriangle(e1, e2, e3);
+  } else if (utils::Parallel::getProcessRank() == 3) {
+    mesh.createVertex(Eigen::VectorXd::Constant(dim, 3.0));
+  }
+
+  mesh.computeState();
+  mesh.allocateDataValues();
+
+  bool             exportNormals = true;
+  io::ExportVTKXML exportVTKXML(exportNormals, true, true);
+  std::string      filename = "io-ExportVTKXMLTest-testExportTriangulatedMeshBinaryAsynchronous";
+  std::string      location = "";
+  // The mesh may change after doExport() returns, as the export works on a copy
+  for (int i = 0; i < 3; i++) {
+    mesh.data()[0]->values().setConstant(i);
+    exportVTKXML.doExport(filename + std::to_string(i), location, mesh);
+  }
+  exportVTKXML.flush();
+
+  if (mesh.vertices().size() > 0) {
+    std::string   subFile = filename + "2_r" + std::to_string(utils::MasterSlave::getRank()) + ".vtu";
+    std::ifstream in(subFile, std::ios::binary);
+    BOOST_TEST(in.good());
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    BOOST_TEST(content.find("<AppendedData encoding=\"raw\">") != std::string::npos);
+    BOOST_TEST(content.find("format=\"appended\"") != std::string::npos);
+
+    // Decodes the appended block of a data array, which is its size in bytes as UInt32 followed by the raw values
+    auto decode = [&content](const std::string &name) {
+      const std::size_t element = content.find("Name=\"" + name + "\"");
+      const std::size_t offset  = std::stoul(content.substr(content.find("offset=\"", element) + 8));
+      const std::size_t begin   = content.find('_', content.find("<AppendedData")) + 1 + offset;
+      std::uint32_t     bytes   = 0;
+      std::memcpy(&bytes, &content[begin], sizeof(bytes));
+      std::vector<double> values(bytes / sizeof(double));
+      std::memcpy(values.data(), &content[begin + sizeof(bytes)], bytes);
+      return values;
+    };
+
+    const std::vector<double> positions = decode("Position");
+    BOOST_TEST(positions.size() == 3 * mesh.vertices().size());
+    const std::vector<double> scalars = decode("ScalarData");
+    BOOST_TEST(scalars.size() == mesh.vertices().size());
+    for (const mesh::Vertex &vertex : mesh.vertices()) {
+      for (int d = 0; d < dim; d++) {
+        BOOST_TEST(positions[3 * vertex.getID() + d] == vertex.getCoords()[d]);
+      }
+      BOOST_TEST(scalars[vertex.getID()] == 2.0);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ExportQuadMesh)
 {
   using namespace mesh;
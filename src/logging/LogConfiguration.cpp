@@ -1,7 +1,10 @@
 #include "LogConfiguration.hpp"
 
 #include <fstream>
+#include <regex>
+#include <set>
 #include <string>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -10,10 +13,15 @@
 #include <boost/log/attributes/mutable_constant.hpp>
 #include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
+#include <boost/log/sinks/block_on_overflow.hpp>
+#include <boost/log/sinks/bounded_fifo_queue.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
 #include <boost/log/support/date_time.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/console.hpp>
 
+#include "logging/Logger.hpp"
 #include "precice/impl/versions.hpp"
 #include "utils/String.hpp"
 #include "utils/assertion.hpp"
@@ -93,6 +101,71 @@ public:
   }
 };
 
+namespace {
+
+/// Sink writing records from a background thread. Logging blocks, if 1024 records are queued.
+using AsynchronousSink = boost::log::sinks::asynchronous_sink<
+    StreamBackend,
+    boost::log::sinks::bounded_fifo_queue<1024, boost::log::sinks::block_on_overflow>>;
+
+/// Holds all asynchronous sinks to write their queued records on reconfiguration and on exit.
+class AsynchronousSinks {
+public:
+  ~AsynchronousSinks()
+  {
+    stop();
+  }
+
+  void add(boost::shared_ptr<AsynchronousSink> sink)
+  {
+    _sinks.push_back(std::move(sink));
+  }
+
+  /// Stops the background threads and writes all queued records.
+  void stop()
+  {
+    for (auto &sink : _sinks) {
+      sink->stop();
+      sink->flush();
+    }
+    _sinks.clear();
+  }
+
+private:
+  std::vector<boost::shared_ptr<AsynchronousSink>> _sinks;
+};
+
+AsynchronousSinks asynchronousSinks;
+
+/// Configuration of the current sinks, see getLoggingConfiguration()
+LoggingConfiguration activeConfiguration;
+
+template <typename Sink>
+void addSink(boost::shared_ptr<Sink> sink, BackendConfiguration const &config)
+{
+  sink->set_formatter(boost::log::parse_formatter(config.format));
+  sink->set_filter(boost::log::parse_filter(config.filter));
+  boost::log::core::get()->add_sink(sink);
+}
+
+} // namespace
+
+// The results of Logger::isEnabled() are cached per logger and severity and
+// invalidated on changes of Rank and Participant. Hence, only filters on these
+// attributes, Severity and Module are cacheable. The filter syntax references
+// attributes by their name enclosed in percent signs.
+bool dependsOnRecord(std::string const &filter)
+{
+  static const std::set<std::string> cacheableAttributes{"Severity", "Module", "Rank", "Participant"};
+  static const std::regex            attribute{"%([^%]*)%"};
+  for (std::sregex_iterator match(filter.begin(), filter.end(), attribute), end; match != end; ++match) {
+    if (cacheableAttributes.count((*match)[1].str()) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /// Reads a log file, returns a logging configuration.
 LoggingConfiguration readLogConfFile(std::string const &filename)
 {
@@ -148,6 +221,9 @@ void BackendConfiguration::setOption(std::string key, std::string value)
   if (key == "enabled") {
     enabled = utils::convertStringToBool(value);
   }
+  if (key == "asynchronous") {
+    asynchronous = utils::convertStringToBool(value);
+  }
 }
 
 void setupLogging(LoggingConfiguration configs, bool enabled)
@@ -173,6 +249,7 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
       << bl::expressions::message;
 
   // Reset
+  asynchronousSinks.stop();
   bl::core::get()->remove_all_sinks();
   bl::core::get()->reset_filter();
 
@@ -181,7 +258,9 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
   // Add the default config
   if (configs.empty())
     configs.emplace_back();
+  activeConfiguration = configs;
 
+  bool cacheable = true;
   for (const auto &config : configs) {
     boost::shared_ptr<StreamBackend> backend;
     if (config.type == "file")
@@ -194,12 +273,22 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
     }
     PRECICE_ASSERT(backend != nullptr, "The logging backend was not initialized properly. Check your log config.");
     backend->auto_flush(true);
-    using sink_t = boost::log::sinks::synchronous_sink<StreamBackend>;
-    boost::shared_ptr<sink_t> sink(new sink_t(backend));
-    sink->set_formatter(boost::log::parse_formatter(config.format));
-    sink->set_filter(boost::log::parse_filter(config.filter));
-    boost::log::core::get()->add_sink(sink);
+    if (config.asynchronous) {
+      boost::shared_ptr<AsynchronousSink> sink(new AsynchronousSink(backend));
+      addSink(sink, config);
+      asynchronousSinks.add(sink);
+    } else {
+      using sink_t = boost::log::sinks::synchronous_sink<StreamBackend>;
+      addSink(boost::shared_ptr<sink_t>(new sink_t(backend)), config);
+    }
+    cacheable = cacheable && not dependsOnRecord(config.filter);
   }
+  invalidateSeverityCache(cacheable);
+}
+
+LoggingConfiguration getLoggingConfiguration()
+{
+  return activeConfiguration;
 }
 
 void setupLogging(std::string const &logConfigFile)
@@ -210,11 +299,13 @@ void setupLogging(std::string const &logConfigFile)
 void setMPIRank(int const rank)
 {
   boost::log::attribute_cast<boost::log::attributes::mutable_constant<int>>(boost::log::core::get()->get_global_attributes()["Rank"]).set(rank);
+  invalidateSeverityCache();
 }
 
 void setParticipant(std::string const &participant)
 {
   boost::log::attribute_cast<boost::log::attributes::mutable_constant<std::string>>(boost::log::core::get()->get_global_attributes()["Participant"]).set(participant);
+  invalidateSeverityCache();
 }
 
 bool _precice_logging_config_lock{false};
@@ -19,6 +19,9 @@ struct BackendConfiguration {
   std::string format  = default_formatter;
   bool        enabled = true;
 
+  /// Write records from a background thread, such that logging only blocks if the queue is full.
+  bool asynchronous = false;
+
   /// Sets on option, overwrites default values.
   void setOption(std::string key, std::string value);
 };
@@ -35,6 +38,12 @@ void setupLogging(std::string const &logConfigFile = "log.conf");
 /// Configures the logging from a LoggingConfiguration
 void setupLogging(LoggingConfiguration configs, bool enabled = true);
 
+/// Returns the configuration of the current sinks, as given to the last call of setupLogging() which was not locked
+LoggingConfiguration getLoggingConfiguration();
+
+/// Returns true, if the filter uses attributes which may change with every record, such that Logger::isEnabled() cannot cache its results
+bool dependsOnRecord(std::string const &filter);
+
 /// Sets the current MPI rank as a logging attribute
 void setMPIRank(int const rank);
 
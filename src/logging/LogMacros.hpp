@@ -13,9 +13,18 @@
 
 #include "Tracer.hpp"
 
-#define PRECICE_WARN(message) _log.warning(PRECICE_LOG_LOCATION, PRECICE_AS_STRING(message))
+// The message is only formatted, if a sink accepts records of the severity
+#define PRECICE_WARN(message)                                         \
+  do {                                                                \
+    if (_log.isEnabled(precice::logging::Logger::Severity::warning))  \
+      _log.warning(PRECICE_LOG_LOCATION, PRECICE_AS_STRING(message)); \
+  } while (false)
 
-#define PRECICE_INFO(message) _log.info(PRECICE_LOG_LOCATION, PRECICE_AS_STRING(message))
+#define PRECICE_INFO(message)                                      \
+  do {                                                             \
+    if (_log.isEnabled(precice::logging::Logger::Severity::info))  \
+      _log.info(PRECICE_LOG_LOCATION, PRECICE_AS_STRING(message)); \
+  } while (false)
 
 #define PRECICE_ERROR(message)                                    \
   do {                                                            \
@@ -39,7 +48,11 @@
 
 #else // NDEBUG
 
-#define PRECICE_DEBUG(message) _log.debug(PRECICE_LOG_LOCATION, PRECICE_AS_STRING(message))
+#define PRECICE_DEBUG(message)                                      \
+  do {                                                              \
+    if (_log.isEnabled(precice::logging::Logger::Severity::debug))  \
+      _log.debug(PRECICE_LOG_LOCATION, PRECICE_AS_STRING(message)); \
+  } while (false)
 
 /// Helper macro, used by TRACE
 #define PRECICE_LOG_ARGUMENT(r, data, i, elem) \
@@ -47,11 +60,12 @@
   << "  Argument " << i << ": " << BOOST_PP_STRINGIZE(elem) << " == " << elem
 
 // Do not put do {...} while (false) here, it will destroy the _tracer_ right after creation
-#define PRECICE_TRACE(...)                                                                                                \
-  precice::logging::Tracer _tracer_(_log, PRECICE_LOG_LOCATION);                                                          \
-  _log.trace(PRECICE_LOG_LOCATION, PRECICE_AS_STRING("Entering " << __func__ BOOST_PP_IF(BOOST_VMD_IS_EMPTY(__VA_ARGS__), \
-                                                                                         BOOST_PP_EMPTY(),                \
-                                                                                         BOOST_PP_SEQ_FOR_EACH_I(PRECICE_LOG_ARGUMENT, , BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__)))));
+#define PRECICE_TRACE(...)                                                                                                  \
+  precice::logging::Tracer _tracer_(_log, PRECICE_LOG_LOCATION);                                                            \
+  if (_log.isEnabled(precice::logging::Logger::Severity::trace))                                                            \
+    _log.trace(PRECICE_LOG_LOCATION, PRECICE_AS_STRING("Entering " << __func__ BOOST_PP_IF(BOOST_VMD_IS_EMPTY(__VA_ARGS__), \
+                                                                                           BOOST_PP_EMPTY(),                \
+                                                                                           BOOST_PP_SEQ_FOR_EACH_I(PRECICE_LOG_ARGUMENT, , BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__)))));
 
 #endif // ! NDEBUG
 
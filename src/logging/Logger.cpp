@@ -1,5 +1,6 @@
 #include "Logger.hpp"
 
+#include <atomic>
 #include <boost/log/attributes/constant.hpp>
 #include <boost/log/attributes/mutable_constant.hpp>
 #include <boost/log/attributes/named_scope.hpp>
@@ -16,12 +17,15 @@ namespace logging {
  *
  * @note The point of using a pimpl for the logger is to remove boost::log from logger.hpp
  */
-class Logger::LoggerImpl : public boost::log::sources::severity_logger<boost::log::trivial::severity_level> {
+class Logger::LoggerImpl : public boost::log::sources::severity_logger_mt<boost::log::trivial::severity_level> {
 public:
   /** Creates a Boost logger for the said module.
    * @param[in] module the name of the module.
    */
   explicit LoggerImpl(std::string module);
+
+  /// Returns true, if any sink would consume a record of the given severity
+  bool willConsume(boost::log::trivial::severity_level severity);
 };
 
 Logger::LoggerImpl::LoggerImpl(std::string module)
@@ -39,6 +43,12 @@ Logger::LoggerImpl::LoggerImpl(std::string module)
   log::core::get()->add_global_attribute("Function", attrs::mutable_constant<std::string>(""));
 }
 
+bool Logger::LoggerImpl::willConsume(boost::log::trivial::severity_level severity)
+{
+  // The record is discarded without being pushed to the sinks
+  return static_cast<bool>(open_record(boost::log::keywords::severity = severity));
+}
+
 Logger::Logger(std::string module)
     : _impl(new LoggerImpl{std::move(module)}) {}
 
@@ -51,7 +61,11 @@ Logger::Logger(const Logger &other)
 {
 }
 
-Logger::Logger(Logger &&other) = default;
+Logger::Logger(Logger &&other)
+    : _impl(std::move(other._impl)),
+      _severityCache(other._severityCache.load())
+{
+}
 
 Logger &Logger::operator=(Logger other)
 {
@@ -62,6 +76,49 @@ Logger &Logger::operator=(Logger other)
 void Logger::swap(Logger &other) noexcept
 {
   _impl.swap(other._impl);
+  _severityCache = other._severityCache.exchange(_severityCache);
+}
+
+namespace {
+/// Incremented by invalidateSeverityCache()
+std::atomic<int> severityCacheVersion{0};
+
+/// False, if the filters cannot be cached
+std::atomic<bool> severityCacheable{true};
+
+/// Marks a packed severity cache as filled, as it starts zeroed
+constexpr std::uint64_t severityCacheFilled = 1u << 8;
+} // namespace
+
+void invalidateSeverityCache(bool cacheable)
+{
+  severityCacheable = cacheable;
+  ++severityCacheVersion;
+}
+
+void invalidateSeverityCache()
+{
+  ++severityCacheVersion;
+}
+
+bool Logger::isEnabled(Severity severity) const
+{
+  if (not severityCacheable) {
+    return true;
+  }
+  const std::uint64_t version = static_cast<std::uint32_t>(severityCacheVersion.load());
+  std::uint64_t       cache   = _severityCache.load(std::memory_order_relaxed);
+  if ((cache & severityCacheFilled) == 0 || (cache >> 32) != version) {
+    // Threads racing here compute the same results, hence the last store wins.
+    cache = (version << 32) | severityCacheFilled;
+    for (int level = 0; level <= static_cast<int>(Severity::error); ++level) {
+      if (_impl->willConsume(static_cast<boost::log::trivial::severity_level>(level))) {
+        cache |= std::uint64_t{1} << level;
+      }
+    }
+    _severityCache.store(cache, std::memory_order_relaxed);
+  }
+  return (cache >> static_cast<int>(severity)) & 1u;
 }
 
 namespace {
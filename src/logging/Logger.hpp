@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -16,6 +18,15 @@ struct LogLocation {
 /// This class provides a leightweight logger.
 class Logger {
 public:
+  /// Severities of log records, in the order of boost::log::trivial::severity_level
+  enum class Severity : int {
+    trace = 0,
+    debug,
+    info,
+    warning,
+    error
+  };
+
   /** Creates a logger for a given module.
    * @param[in] the name of the module 
    */
@@ -37,13 +48,40 @@ public:
   void trace(LogLocation loc, const std::string &mess);
   ///@}
 
+  /** Returns false, if no sink accepts records of the given severity from this logger.
+   *
+   * The log macros call this before formatting the message. The result is
+   * cached per severity until invalidateSeverityCache() is called.
+   */
+  bool isEnabled(Severity severity) const;
+
 private:
   /// Forward declaration of the implementation of the logger
   class LoggerImpl;
   /// Pimpl to the logger implementation
   std::unique_ptr<LoggerImpl> _impl;
+
+  /** Cached results of isEnabled(), packed into one word to be shared by threads.
+   *
+   * The upper 32 bits hold the version of the severity cache the results belong to,
+   * the lower bits hold one bit per severity and a bit marking the cache as filled.
+   */
+  mutable std::atomic<std::uint64_t> _severityCache{0};
 };
 
+/** Invalidates the results cached by Logger::isEnabled() of all loggers.
+ *
+ * This has to be called whenever the result of the filters may change, e.g., on
+ * changes of the sinks or of the attributes Rank and Participant.
+ *
+ * @param[in] cacheable false, if filters depend on attributes which change per
+ *            record, such as Line. Then, Logger::isEnabled() always returns true.
+ */
+void invalidateSeverityCache(bool cacheable);
+
+/// Invalidates the results cached by Logger::isEnabled(), keeping whether they are cacheable.
+void invalidateSeverityCache();
+
 } // namespace logging
 } // namespace precice
 
@@ -14,7 +14,8 @@ Tracer::Tracer(
 
 Tracer::~Tracer()
 {
-  _log.trace(_loc, std::string{"Leaving "}.append(_loc.func));
+  if (_log.isEnabled(Logger::Severity::trace))
+    _log.trace(_loc, std::string{"Leaving "}.append(_loc.func));
 }
 
 } // namespace logging
@@ -44,6 +44,10 @@ LogConfiguration::LogConfiguration(
                          .setDocumentation("Enables the sink");
   tagSink.addAttribute(attrEnabled);
 
+  auto attrAsynchronous = makeXMLAttribute("asynchronous", false)
+                              .setDocumentation("Writes records from a background thread. Logging only blocks, if 1024 records are queued.");
+  tagSink.addAttribute(attrAsynchronous);
+
   tagLog.addSubtag(tagSink);
   parent.addSubtag(tagLog);
 }
@@ -61,6 +65,7 @@ void LogConfiguration::xmlTagCallback(
     config.setOption("filter", tag.getStringAttributeValue("filter"));
     config.setOption("format", tag.getStringAttributeValue("format"));
     config.setOption("enabled", "true"); // Not needed, but correct.
+    config.setOption("asynchronous", tag.getBooleanAttributeValue("asynchronous") ? "true" : "false");
     _logconfig.push_back(config);
   }
 }
@@ -0,0 +1,158 @@
+#include <boost/core/null_deleter.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/text_ostream_backend.hpp>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "logging/LogConfiguration.hpp"
+#include "logging/Logger.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::logging;
+
+namespace {
+/// Unlocks the log configuration of the test runner and restores it afterwards
+struct LogConfigurationFixture {
+  LogConfigurationFixture()
+      : _configs(getLoggingConfiguration()),
+        _enabled(boost::log::core::get()->get_logging_enabled()),
+        _locked(_precice_logging_config_lock)
+  {
+    _precice_logging_config_lock = false;
+  }
+
+  ~LogConfigurationFixture()
+  {
+    setupLogging(_configs, _enabled);
+    _precice_logging_config_lock = _locked;
+  }
+
+  /// Logs to a file, keeping only records of the given severity and above
+  static void setupFileLogging(std::string const &filename, std::string const &filter, bool asynchronous = false)
+  {
+    BackendConfiguration config;
+    config.type         = "file";
+    config.output       = filename;
+    config.filter       = filter;
+    config.format       = "%Message%";
+    config.asynchronous = asynchronous;
+    setupLogging(LoggingConfiguration{config});
+  }
+
+  /// Log configuration of the test runner
+  LoggingConfiguration _configs;
+  bool                 _enabled;
+  bool                 _locked;
+};
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(LoggingTests)
+BOOST_FIXTURE_TEST_SUITE(LoggerTests, LogConfigurationFixture, *testing::OnMaster())
+
+BOOST_AUTO_TEST_CASE(SeverityCache)
+{
+  setupFileLogging("logging-LoggerTest-SeverityCache.log", "%Severity% >= warning");
+  Logger logger("logging::LoggerTest");
+  BOOST_TEST(not logger.isEnabled(Logger::Severity::debug));
+  BOOST_TEST(logger.isEnabled(Logger::Severity::warning));
+
+  // Accepts all records of this logger, without invalidating the cache
+  namespace bl = boost::log;
+  using Sink   = bl::sinks::synchronous_sink<bl::sinks::text_ostream_backend>;
+  auto sink    = boost::make_shared<Sink>();
+  std::ostringstream out;
+  sink->locked_backend()->add_stream(boost::shared_ptr<std::ostream>(&out, boost::null_deleter()));
+  sink->set_filter(bl::expressions::attr<std::string>("Module") == "logging::LoggerTest");
+  bl::core::get()->add_sink(sink);
+
+  BOOST_TEST(not logger.isEnabled(Logger::Severity::debug));
+  invalidateSeverityCache();
+  BOOST_TEST(logger.isEnabled(Logger::Severity::debug));
+
+  bl::core::get()->remove_sink(sink);
+  BOOST_TEST(logger.isEnabled(Logger::Severity::debug));
+  invalidateSeverityCache();
+  BOOST_TEST(not logger.isEnabled(Logger::Severity::debug));
+  BOOST_TEST(logger.isEnabled(Logger::Severity::warning));
+
+  // Copies start with an empty cache
+  Logger copy(logger);
+  BOOST_TEST(not copy.isEnabled(Logger::Severity::debug));
+}
+
+BOOST_AUTO_TEST_CASE(UncacheableFilter)
+{
+  setupFileLogging("logging-LoggerTest-UncacheableFilter.log", "%Line% < 0");
+  Logger logger("logging::LoggerTest");
+  BOOST_TEST(logger.isEnabled(Logger::Severity::trace));
+
+  setupFileLogging("logging-LoggerTest-UncacheableFilter.log", "%Severity% >= error");
+  BOOST_TEST(not logger.isEnabled(Logger::Severity::trace));
+  BOOST_TEST(logger.isEnabled(Logger::Severity::error));
+}
+
+BOOST_AUTO_TEST_CASE(Threads)
+{
+  setupFileLogging("logging-LoggerTest-Threads.log", "%Severity% >= info");
+  Logger logger("logging::LoggerTest");
+
+  std::atomic<bool>        mismatch{false};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 10000; ++i) {
+        if (logger.isEnabled(Logger::Severity::debug) or not logger.isEnabled(Logger::Severity::info)) {
+          mismatch = true;
+        }
+      }
+    });
+  }
+  for (int i = 0; i < 1000; ++i) {
+    invalidateSeverityCache();
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  BOOST_TEST(not mismatch);
+}
+
+BOOST_AUTO_TEST_CASE(DependsOnRecord)
+{
+  BOOST_TEST(not dependsOnRecord(""));
+  BOOST_TEST(not dependsOnRecord("%Severity% >= debug"));
+  BOOST_TEST(not dependsOnRecord("%Module% contains \"mapping\" and %Rank% = 0"));
+  BOOST_TEST(not dependsOnRecord("%Participant% = \"SolverOne\""));
+  BOOST_TEST(dependsOnRecord("%Line% > 100"));
+  BOOST_TEST(dependsOnRecord("%Severity% >= debug and %File% contains \"Mapping\""));
+  BOOST_TEST(dependsOnRecord("%TimeStamp% > \"2019-01-01 00:00:00\""));
+  BOOST_TEST(dependsOnRecord("%Scope% contains \"initialize\""));
+}
+
+BOOST_AUTO_TEST_CASE(AsynchronousSink)
+{
+  // More records than the queue of the sink holds
+  const int   records  = 2000;
+  std::string filename = "logging-LoggerTest-AsynchronousSink.log";
+  setupFileLogging(filename, "%Module% = \"logging::LoggerTest\"", true);
+  Logger logger("logging::LoggerTest");
+  for (int i = 0; i < records; ++i) {
+    logger.info({__FILE__, __LINE__, __func__}, std::to_string(i));
+  }
+  // Writes all queued records
+  setupFileLogging("logging-LoggerTest-AsynchronousSink-other.log", "%Severity% >= warning");
+
+  std::ifstream file(filename);
+  std::string   line;
+  int           lines = 0;
+  while (std::getline(file, line)) {
+    BOOST_TEST(line == std::to_string(lines));
+    ++lines;
+  }
+  BOOST_TEST(lines == records);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LoggerTests
+BOOST_AUTO_TEST_SUITE_END() // LoggingTests
@@ -116,6 +116,23 @@ public:
       size_t  size,
       int     valueDimension) = 0;
 
+  /**
+   * @brief Starts receiving an array of doubles, which is finished by completeReceive().
+   *
+   * itemsToReceive has to stay valid until completeReceive() returns. Only one
+   * receive may be pending at a time. The default implementation receives blocking.
+   */
+  virtual void startReceive(
+      double *itemsToReceive,
+      size_t  size,
+      int     valueDimension)
+  {
+    receive(itemsToReceive, size, valueDimension);
+  }
+
+  /// Waits for the receive started by startReceive().
+  virtual void completeReceive() {}
+
   /*
    * A mapping from remote local ranks to the IDs that must be communicated
    */
@@ -4,6 +4,7 @@
 #include "com/Communication.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/Event.hpp"
+#include "utils/EventUtils.hpp"
 #include "utils/MasterSlave.hpp"
 
 using precice::utils::Event;
@@ -17,7 +18,9 @@ M2N::M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer d
     : _masterCom(masterCom),
       _distrFactory(distrFactory),
       _useOnlyMasterCom(useOnlyMasterCom),
-      _useTwoLevelInit(useTwoLevelInit)
+      _useTwoLevelInit(useTwoLevelInit),
+      _sendDataEvent(utils::EventRegistry::instance().getEventID("m2n.sendData")),
+      _receiveDataEvent(utils::EventRegistry::instance().getEventID("m2n.receiveData"))
 {
 }
 
@@ -206,7 +209,7 @@ void M2N::send(
         _masterCom->send(ack, 0);
       }
     }
-    Event e("m2n.sendData", precice::syncMode);
+    Event e(_sendDataEvent, precice::syncMode);
     _distComs[meshID]->send(itemsToSend, size, valueDimension);
   } else {
     PRECICE_ASSERT(_isMasterConnected);
@@ -264,6 +267,15 @@ void M2N::receive(double *itemsToReceive,
                   int     size,
                   int     meshID,
                   int     valueDimension)
+{
+  startReceive(itemsToReceive, size, meshID, valueDimension);
+  completeReceive();
+}
+
+void M2N::startReceive(double *itemsToReceive,
+                       int     size,
+                       int     meshID,
+                       int     valueDimension)
 {
   if (not _useOnlyMasterCom) {
     PRECICE_ASSERT(_areSlavesConnected);
@@ -279,14 +291,23 @@ void M2N::receive(double *itemsToReceive,
         _masterCom->receive(ack, 0);
       }
     }
-    Event e("m2n.receiveData", precice::syncMode);
-    _distComs[meshID]->receive(itemsToReceive, size, valueDimension);
+    _distComs[meshID]->startReceive(itemsToReceive, size, valueDimension);
+    _pendingReceiveMeshIDs.push_back(meshID);
   } else {
     PRECICE_ASSERT(_isMasterConnected);
     _masterCom->receive(itemsToReceive, size, 0);
   }
 }
 
+void M2N::completeReceive()
+{
+  Event e(_receiveDataEvent, precice::syncMode);
+  for (int meshID : _pendingReceiveMeshIDs) {
+    _distComs[meshID]->completeReceive();
+  }
+  _pendingReceiveMeshIDs.clear();
+}
+
 void M2N::receive(bool &itemToReceive)
 {
   PRECICE_TRACE(utils::MasterSlave::getRank());
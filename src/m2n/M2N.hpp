@@ -1,6 +1,7 @@
 #pragma once
 
 #include <map>
+#include <vector>
 #include "DistributedComFactory.hpp"
 #include "SharedPointer.hpp"
 #include "com/SharedPointer.hpp"
@@ -163,6 +164,21 @@ public:
                int     meshID,
                int     valueDimension);
 
+  /**
+   * @brief Starts receiving an array of doubles, which is finished by completeReceive().
+   *
+   * Receives of several meshes and of several M2Ns may be pending at the same time.
+   * itemsToReceive has to stay valid until completeReceive() returns. When only the
+   * master communication is used, the receive is blocking.
+   */
+  void startReceive(double *itemsToReceive,
+                    int     size,
+                    int     meshID,
+                    int     valueDimension);
+
+  /// Waits for all receives started by startReceive().
+  void completeReceive();
+
   /// All slaves receive a bool (the same for each slave).
   void receive(bool &itemToReceive);
 
@@ -200,6 +216,9 @@ private:
 
   bool _areSlavesConnected = false;
 
+  /// IDs of the meshes with a receive started by startReceive()
+  std::vector<int> _pendingReceiveMeshIDs;
+
   // The following flag is (solely) needed for unit tests between two serial participants.
   // To also use the slaves-slaves communication would require a lengthy setup of meshes
   // and their re-partitioning, which could also not be moved to some fixture as the M2Ns
@@ -214,6 +233,10 @@ private:
   /// use the two-level initialization concept
   bool _useTwoLevelInit = false;
 
+  /// IDs of the events of sending and receiving data
+  int _sendDataEvent;
+  int _receiveDataEvent;
+
   // @brief To allow access to _useOnlyMasterCom
   friend struct WhiteboxAccessor;
 };
@@ -1,4 +1,5 @@
 #include "PointToPointCommunication.hpp"
+#include <algorithm>
 #include <boost/container/flat_map.hpp>
 #include <iomanip>
 #include <thread>
@@ -372,7 +373,7 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
     int  globalRequesterRank = comMap.first;
     auto indices             = std::move(communicationMap[globalRequesterRank]);
 
-    _mappings.push_back({globalRequesterRank, std::move(indices), com::PtrRequest(), {}});
+    _mappings.push_back({globalRequesterRank, std::move(indices), com::PtrRequest()});
   }
   e4.stop();
   _isConnected = true;
@@ -502,7 +503,7 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
     auto globalAcceptorRank = i.first;
     auto indices            = std::move(i.second);
 
-    _mappings.push_back({globalAcceptorRank, std::move(indices), com::PtrRequest(), {}});
+    _mappings.push_back({globalAcceptorRank, std::move(indices), com::PtrRequest()});
   }
   e4.stop();
   _isConnected = true;
@@ -543,7 +544,7 @@ void PointToPointCommunication::completeSlavesConnection()
   mesh::Mesh::CommunicationMap localCommunicationMap = _mesh->getCommunicationMap();
 
   for (auto &i : _connectionDataVector) {
-    _mappings.push_back({i.remoteRank, std::move(localCommunicationMap[i.remoteRank]), i.request, {}});
+    _mappings.push_back({i.remoteRank, std::move(localCommunicationMap[i.remoteRank]), i.request});
   }
 }
 
@@ -555,6 +556,11 @@ void PointToPointCommunication::closeConnection()
     return;
 
   checkBufferedRequests(true);
+  for (auto &mapping : _mappings) {
+    if (mapping.sendRequest) {
+      mapping.sendRequest->wait();
+    }
+  }
 
   _communication.reset();
   _mappings.clear();
@@ -571,17 +577,21 @@ void PointToPointCommunication::send(double const *itemsToSend,
   }
 
   for (auto &mapping : _mappings) {
-    // if (utils::MasterSlave::isMaster())
-    //   std::cout<< "indices " << mapping.indices << std::endl;
-    auto buffer = std::make_shared<std::vector<double>>();
-    buffer->reserve(mapping.indices.size() * valueDimension);
+    if (mapping.sendRequest && not mapping.sendRequest->test()) {
+      // The previous send is still pending, hence its buffer cannot be reused.
+      bufferedRequests.emplace_back(mapping.sendRequest, mapping.sendBuffer);
+      mapping.sendBuffer.reset();
+    }
+    if (not mapping.sendBuffer) {
+      mapping.sendBuffer = std::make_shared<std::vector<double>>();
+    }
+    auto &buffer = *mapping.sendBuffer;
+    buffer.resize(mapping.indices.size() * valueDimension);
+    auto out = buffer.begin();
     for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        buffer->push_back(itemsToSend[index * valueDimension + d]);
-      }
+      out = std::copy_n(itemsToSend + index * valueDimension, valueDimension, out);
     }
-    auto request = _communication->aSend(*buffer, mapping.remoteRank);
-    bufferedRequests.emplace_back(request, buffer);
+    mapping.sendRequest = _communication->aSend(buffer, mapping.remoteRank);
   }
   checkBufferedRequests(false);
 }
@@ -590,6 +600,15 @@ void PointToPointCommunication::receive(double *itemsToReceive,
                                         size_t  size,
                                         int     valueDimension)
 {
+  startReceive(itemsToReceive, size, valueDimension);
+  completeReceive();
+}
+
+void PointToPointCommunication::startReceive(double *itemsToReceive,
+                                             size_t  size,
+                                             int     valueDimension)
+{
+  PRECICE_ASSERT(_pendingReceive == nullptr, "Only one receive can be pending at a time.");
   if (_mappings.empty()) {
     return;
   }
@@ -597,23 +616,33 @@ void PointToPointCommunication::receive(double *itemsToReceive,
   std::fill(itemsToReceive, itemsToReceive + size, 0);
 
   for (auto &mapping : _mappings) {
-    // if (not utils::MasterSlave::isMaster())
-    //   std::cout<< "indices " << mapping.indices << std::endl;
     mapping.recvBuffer.resize(mapping.indices.size() * valueDimension);
     mapping.request = _communication->aReceive(mapping.recvBuffer, mapping.remoteRank);
   }
+  _pendingReceive          = itemsToReceive;
+  _pendingReceiveDimension = valueDimension;
+}
+
+void PointToPointCommunication::completeReceive()
+{
+  if (_pendingReceive == nullptr) {
+    return;
+  }
 
+  const int valueDimension = _pendingReceiveDimension;
   for (auto &mapping : _mappings) {
     mapping.request->wait();
 
-    int i = 0;
+    const double *in = mapping.recvBuffer.data();
     for (auto index : mapping.indices) {
+      double *out = _pendingReceive + index * valueDimension;
       for (int d = 0; d < valueDimension; ++d) {
-        itemsToReceive[index * valueDimension + d] += mapping.recvBuffer[i * valueDimension + d];
+        out[d] += in[d];
       }
-      i++;
+      in += valueDimension;
     }
   }
+  _pendingReceive = nullptr;
 }
 
 void PointToPointCommunication::broadcastSend(const int &itemToSend)
@@ -97,6 +97,14 @@ public:
                size_t  size,
                int     valueDimension = 1) override;
 
+  /// Posts the receives from all connected ranks, see receive().
+  void startReceive(double *itemsToReceive,
+                    size_t  size,
+                    int     valueDimension = 1) override;
+
+  /// Waits for all receives posted by startReceive() and accumulates the received values.
+  void completeReceive() override;
+
   /// Broadcasts an int to connected ranks on remote participant
   void broadcastSend(const int &itemToSend) override;
 
@@ -143,12 +151,21 @@ private:
    *           the current process rank and the remote process rank;
    *        3. Request holding information about pending communication
    *        4. Appropriately sized buffer to receive elements
+   *        5. Request of the last send and the buffer it sends from, which is
+   *           reused by the next send once the request completed
    */
   struct Mapping {
-    int                 remoteRank;
-    std::vector<int>    indices;
-    com::PtrRequest     request;
-    std::vector<double> recvBuffer;
+    Mapping(int remoteRank, std::vector<int> indices, com::PtrRequest request)
+        : remoteRank(remoteRank), indices(std::move(indices)), request(std::move(request))
+    {
+    }
+
+    int                                  remoteRank;
+    std::vector<int>                     indices;
+    com::PtrRequest                      request;
+    std::vector<double>                  recvBuffer;
+    com::PtrRequest                      sendRequest = nullptr;
+    std::shared_ptr<std::vector<double>> sendBuffer  = nullptr;
   };
 
   /**
@@ -177,6 +194,10 @@ private:
 
   bool _isConnected = false;
 
+  /// Destination and value dimension of the receive started by startReceive(), nullptr if none is pending
+  double *_pendingReceive          = nullptr;
+  int     _pendingReceiveDimension = 1;
+
   std::list<std::pair<std::shared_ptr<com::Request>,
                       std::shared_ptr<std::vector<double>>>>
       bufferedRequests;
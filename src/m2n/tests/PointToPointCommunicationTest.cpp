@@ -26,6 +26,17 @@ void process(vector<double> &data)
   }
 }
 
+/// Returns the values as 2D vector data, with the negated values as second component.
+vector<double> toVectorData(const vector<double> &data)
+{
+  vector<double> result;
+  for (double elem : data) {
+    result.push_back(elem);
+    result.push_back(-elem);
+  }
+  return result;
+}
+
 void P2PComTest1(com::PtrCommunicationFactory cf)
 {
   BOOST_TEST(Parallel::getCommunicatorSize() == 4);
@@ -120,17 +131,31 @@ void P2PComTest1(com::PtrCommunicationFactory cf)
   if (Parallel::getProcessRank() < 2) {
     c.requestConnection("B", "A");
 
+    const vector<double> initialData = data;
     c.send(data.data(), data.size());
     c.receive(data.data(), data.size());
 
     BOOST_TEST(data == expectedData);
+
+    // Send buffers are reused, repeated sends must not alter pending messages.
+    vector<double> vectorData = toVectorData(initialData);
+    c.send(initialData.data(), initialData.size());
+    c.send(vectorData.data(), vectorData.size(), 2);
   } else {
     c.acceptConnection("B", "A");
 
     c.receive(data.data(), data.size());
     BOOST_TEST(data == expectedData);
+    const vector<double> receivedData = data;
     process(data);
     c.send(data.data(), data.size());
+
+    vector<double> scalarData(receivedData.size(), -1);
+    vector<double> vectorData(2 * receivedData.size(), -1);
+    c.receive(scalarData.data(), scalarData.size());
+    c.receive(vectorData.data(), vectorData.size(), 2);
+    BOOST_TEST(scalarData == receivedData);
+    BOOST_TEST(vectorData == toVectorData(receivedData));
   }
 
   MasterSlave::_communication.reset();
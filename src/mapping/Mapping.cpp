@@ -1,5 +1,6 @@
 #include "Mapping.hpp"
 #include <boost/config.hpp>
+#include "utils/EventUtils.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -25,6 +26,13 @@ void Mapping::setMeshes(
   _output = output;
 }
 
+void Mapping::mapBatch(const DataIDPairs &dataIDs)
+{
+  for (const auto &ids : dataIDs) {
+    map(ids.first, ids.second);
+  }
+}
+
 const mesh::PtrMesh &Mapping::getInputMesh() const
 {
   return _input;
@@ -50,6 +58,11 @@ Mapping::MeshRequirement Mapping::getOutputRequirement() const
   return _outputRequirement;
 }
 
+void Mapping::setCache(const PtrMappingCache &cache)
+{
+  _cache = cache;
+}
+
 mesh::PtrMesh Mapping::input() const
 {
   return _input;
@@ -77,6 +90,16 @@ int Mapping::getDimensions() const
   return _dimensions;
 }
 
+const PtrMappingCache &Mapping::getCache() const
+{
+  return _cache;
+}
+
+int Mapping::getEventID(const std::string &name) const
+{
+  return utils::EventRegistry::instance().getEventID(name + ".From" + _input->getName() + "To" + _output->getName());
+}
+
 bool operator<(Mapping::MeshRequirement lhs, Mapping::MeshRequirement rhs)
 {
   switch (lhs) {
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <string>
+#include <utility>
+#include <vector>
+#include "mapping/SharedPointer.hpp"
 #include "mesh/Mesh.hpp"
 
 namespace precice {
@@ -72,6 +76,13 @@ public:
   /// Returns the requirement on the output mesh.
   MeshRequirement getOutputRequirement() const;
 
+  /**
+   * @brief Sets a cache to store computed mappings in and to load them from.
+   *
+   * Mappings which do not support caching ignore the cache.
+   */
+  void setCache(const PtrMappingCache &cache);
+
   /// Computes the mapping coefficients from the in- and output mesh.
   virtual void computeMapping() = 0;
 
@@ -98,6 +109,23 @@ public:
       int inputDataID,
       int outputDataID) = 0;
 
+  /// Pairs of input and output data IDs to be mapped together
+  using DataIDPairs = std::vector<std::pair<int, int>>;
+
+  /**
+   * @brief Maps several data fields at once from input mesh to output mesh.
+   *
+   * The default implementation calls map() for every pair. Mappings which can
+   * reuse work across fields, e.g., a factorization, override this.
+   *
+   * Pre-conditions:
+   * - hasComputedMapping() returns true
+   *
+   * Post-conditions:
+   * - output values of all pairs are computed from input values
+   */
+  virtual void mapBatch(const DataIDPairs &dataIDs);
+
   /// Method used by partition. Tags vertices that could be owned by this rank.
   virtual void tagMeshFirstRound() = 0;
 
@@ -119,6 +147,12 @@ protected:
 
   int getDimensions() const;
 
+  /// Returns the mapping cache, which is empty if none is configured.
+  const PtrMappingCache &getCache() const;
+
+  /// Registers the event "<name>.From<input mesh>To<output mesh>" and returns its ID.
+  int getEventID(const std::string &name) const;
+
 private:
   /// Determines wether mapping is consistent or conservative.
   Constraint _constraint;
@@ -136,6 +170,9 @@ private:
   mesh::PtrMesh _output;
 
   int _dimensions;
+
+  /// Cache of computed mappings, optional.
+  PtrMappingCache _cache;
 };
 
 /** Defines an ordering for MeshRequirement in terms of specificality
@@ -0,0 +1,226 @@
+#include "MappingCache.hpp"
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include "utils/MasterSlave.hpp"
+
+namespace precice {
+namespace mapping {
+
+namespace {
+
+/// Identifies files written by the MappingCache.
+constexpr std::uint64_t MAGIC = 0x50524543434d4150; // "PRECCMAP"
+
+/// Increase whenever the file layout changes.
+constexpr std::uint32_t VERSION = 1;
+
+/// 64-bit FNV-1a hash
+class Hasher {
+public:
+  void add(const void *data, std::size_t size)
+  {
+    auto bytes = static_cast<const unsigned char *>(data);
+    for (std::size_t i = 0; i < size; i++) {
+      _hash ^= bytes[i];
+      _hash *= 0x100000001b3;
+    }
+  }
+
+  template <typename T>
+  void add(const T &value)
+  {
+    add(&value, sizeof(T));
+  }
+
+  void add(const std::string &value)
+  {
+    add(value.size());
+    add(value.data(), value.size());
+  }
+
+  void add(const mesh::Mesh &mesh)
+  {
+    add(mesh.getDimensions());
+    add(mesh.vertices().size());
+    for (const mesh::Vertex &vertex : mesh.vertices()) {
+      const Eigen::VectorXd &coords = vertex.getCoords();
+      add(coords.data(), sizeof(double) * coords.size());
+    }
+    add(mesh.edges().size());
+    for (const mesh::Edge &edge : mesh.edges()) {
+      add(edge.vertex(0).getID());
+      add(edge.vertex(1).getID());
+    }
+    add(mesh.triangles().size());
+    for (const mesh::Triangle &triangle : mesh.triangles()) {
+      for (int i = 0; i < 3; i++) {
+        add(triangle.vertex(i).getID());
+      }
+    }
+    add(mesh.quads().size());
+    for (const mesh::Quad &quad : mesh.quads()) {
+      for (int i = 0; i < 4; i++) {
+        add(quad.vertex(i).getID());
+      }
+    }
+  }
+
+  std::uint64_t get() const
+  {
+    return _hash;
+  }
+
+private:
+  std::uint64_t _hash = 0xcbf29ce484222325;
+};
+
+template <typename T>
+void writeValue(std::ostream &out, const T &value)
+{
+  out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream &in, T &value)
+{
+  return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+template <typename T>
+void writeVector(std::ostream &out, const std::vector<T> &values)
+{
+  writeValue(out, static_cast<std::uint64_t>(values.size()));
+  out.write(reinterpret_cast<const char *>(values.data()), sizeof(T) * values.size());
+}
+
+/// Returns the amount of bytes between the read position and the end of the stream
+std::uint64_t remainingBytes(std::istream &in)
+{
+  const std::streampos position = in.tellg();
+  in.seekg(0, std::ios::end);
+  const std::streampos end = in.tellg();
+  in.seekg(position);
+  if (position < 0 || end < position) {
+    return 0;
+  }
+  return end - position;
+}
+
+template <typename T>
+bool readVector(std::istream &in, std::vector<T> &values)
+{
+  std::uint64_t size = 0;
+  if (not readValue(in, size)) {
+    return false;
+  }
+  // A corrupt size must not cause an arbitrary allocation
+  if (size > remainingBytes(in) / sizeof(T)) {
+    return false;
+  }
+  values.resize(size);
+  return static_cast<bool>(in.read(reinterpret_cast<char *>(values.data()), sizeof(T) * size));
+}
+
+} // namespace
+
+MappingCache::MappingCache(std::string directory)
+    : _directory(std::move(directory))
+{
+}
+
+const std::string &MappingCache::getDirectory() const
+{
+  return _directory;
+}
+
+std::uint64_t MappingCache::computeKey(
+    const std::string &description,
+    const mesh::Mesh & input,
+    const mesh::Mesh & output)
+{
+  Hasher hasher;
+  hasher.add(description);
+  hasher.add(input);
+  hasher.add(output);
+  return hasher.get();
+}
+
+bool MappingCache::load(std::uint64_t key, Entry &entry) const
+{
+  PRECICE_TRACE(key);
+  const std::string filename = getFilename(key);
+  std::ifstream     in(filename, std::ios::binary);
+  if (not in) {
+    PRECICE_DEBUG("No cached mapping found in " << filename);
+    return false;
+  }
+
+  std::uint64_t magic = 0, storedKey = 0;
+  std::uint32_t version = 0;
+  bool          valid   = readValue(in, magic) && readValue(in, version) && readValue(in, storedKey);
+  if (not valid || magic != MAGIC || version != VERSION || storedKey != key) {
+    PRECICE_WARN("Ignoring cached mapping " << filename << ", as it was written by an incompatible version or belongs to a different mapping.");
+    return false;
+  }
+
+  Entry loaded;
+  if (not(readVector(in, loaded.indices) && readVector(in, loaded.values))) {
+    PRECICE_WARN("Ignoring cached mapping " << filename << ", as it is truncated.");
+    return false;
+  }
+  entry = std::move(loaded);
+  PRECICE_DEBUG("Loaded cached mapping from " << filename);
+  return true;
+}
+
+void MappingCache::store(std::uint64_t key, const Entry &entry) const
+{
+  PRECICE_TRACE(key);
+  namespace fs = boost::filesystem;
+  const std::string filename = getFilename(key);
+  // Ranks with identical meshes write the same file, hence every rank writes to
+  // its own temporary file first and renames it afterwards.
+  fs::path                  tmp(filename + "~" + std::to_string(utils::MasterSlave::getRank()));
+  boost::system::error_code error;
+  fs::create_directories(tmp.parent_path(), error);
+  if (error) {
+    PRECICE_WARN("Creating the mapping cache directory " << tmp.parent_path().string() << " failed: " << error.message());
+    return;
+  }
+  bool written = false;
+  {
+    std::ofstream out(tmp.string(), std::ios::binary | std::ios::trunc);
+    writeValue(out, MAGIC);
+    writeValue(out, VERSION);
+    writeValue(out, key);
+    writeVector(out, entry.indices);
+    writeVector(out, entry.values);
+    out.close();
+    written = static_cast<bool>(out);
+  }
+  if (not written) {
+    PRECICE_WARN("Writing cached mapping " << tmp.string() << " failed.");
+    fs::remove(tmp, error);
+    return;
+  }
+  fs::rename(tmp, filename, error);
+  if (error) {
+    PRECICE_WARN("Storing cached mapping " << filename << " failed: " << error.message());
+    fs::remove(tmp, error);
+    return;
+  }
+  PRECICE_DEBUG("Stored mapping in cache " << filename);
+}
+
+std::string MappingCache::getFilename(std::uint64_t key) const
+{
+  std::ostringstream name;
+  name << std::hex << std::setw(16) << std::setfill('0') << key << ".map";
+  return (boost::filesystem::path(_directory) / name.str()).string();
+}
+
+} // namespace mapping
+} // namespace precice
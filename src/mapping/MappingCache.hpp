@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "logging/Logger.hpp"
+#include "mesh/Mesh.hpp"
+
+namespace precice {
+namespace mapping {
+
+/**
+ * @brief Stores computed mapping operators on disk to reuse them in later runs.
+ *
+ * Every entry is identified by a key, which is a hash of the mapping
+ * description (type, constraint, parameters) and of the coordinates and
+ * connectivity of both meshes. Hence, an entry is only reused if the mapping
+ * would be computed from exactly the same input.
+ *
+ * Entries are written to one binary file per key in the cache directory.
+ */
+class MappingCache {
+public:
+  /// The serialized operator of a mapping.
+  struct Entry {
+    std::vector<int>    indices;
+    std::vector<double> values;
+  };
+
+  /// Constructor, taking the directory to store entries in.
+  explicit MappingCache(std::string directory);
+
+  const std::string &getDirectory() const;
+
+  /// Computes the key of a mapping from its description and its meshes.
+  static std::uint64_t computeKey(
+      const std::string &description,
+      const mesh::Mesh & input,
+      const mesh::Mesh & output);
+
+  /**
+   * @brief Reads the entry stored under the given key.
+   *
+   * @return false, if there is no entry or it cannot be read.
+   */
+  bool load(std::uint64_t key, Entry &entry) const;
+
+  /// Stores the entry under the given key, replacing a previous one.
+  void store(std::uint64_t key, const Entry &entry) const;
+
+private:
+  mutable logging::Logger _log{"mapping::MappingCache"};
+
+  std::string _directory;
+
+  /// Returns the name of the file storing the entry with the given key.
+  std::string getFilename(std::uint64_t key) const;
+};
+
+} // namespace mapping
+} // namespace precice
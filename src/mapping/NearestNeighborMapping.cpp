@@ -1,11 +1,14 @@
 #include "NearestNeighborMapping.hpp"
 #include <Eigen/Core>
+#include <algorithm>
 #include <boost/container/flat_set.hpp>
 #include <boost/function_output_iterator.hpp>
+#include "mapping/MappingCache.hpp"
 #include "mesh/RTree.hpp"
 #include "query/FindClosestVertex.hpp"
 #include "utils/Event.hpp"
 #include "utils/Helpers.hpp"
+#include "utils/ParallelFor.hpp"
 #include "utils/Statistics.hpp"
 
 namespace precice {
@@ -13,10 +16,24 @@ extern bool syncMode;
 
 namespace mapping {
 
+namespace {
+/// Accumulates the distances in order, such that the result does not depend on the amount of threads.
+utils::statistics::DistanceAccumulator accumulateDistances(const std::vector<double> &distances)
+{
+  utils::statistics::DistanceAccumulator distanceStatistics;
+  for (double distance : distances) {
+    distanceStatistics(distance);
+  }
+  return distanceStatistics;
+}
+} // namespace
+
 NearestNeighborMapping::NearestNeighborMapping(
     Constraint constraint,
-    int        dimensions)
-    : Mapping(constraint, dimensions)
+    int        dimensions,
+    int        threads)
+    : Mapping(constraint, dimensions),
+      _threads(utils::resolveThreadCount(threads))
 {
   setInputRequirement(Mapping::MeshRequirement::VERTEX);
   setOutputRequirement(Mapping::MeshRequirement::VERTEX);
@@ -31,50 +48,92 @@ void NearestNeighborMapping::computeMapping()
 
   const std::string     baseEvent = "map.nn.computeMapping.From" + input()->getName() + "To" + output()->getName();
   precice::utils::Event e(baseEvent, precice::syncMode);
+  _mapDataEvent = getEventID("map.nn.mapData");
+
+  std::uint64_t cacheKey = 0;
+  if (getCache()) {
+    const std::string description = "nearest-neighbor:" + std::to_string(getConstraint()) + ":" + std::to_string(getDimensions());
+    cacheKey                      = MappingCache::computeKey(description, *input(), *output());
+    if (loadFromCache(cacheKey)) {
+      PRECICE_INFO("Loaded mapping from cache " << getCache()->getDirectory());
+      _hasComputedMapping = true;
+      return;
+    }
+  }
 
   if (getConstraint() == CONSISTENT) {
     PRECICE_DEBUG("Compute consistent mapping");
     precice::utils::Event e2(baseEvent + ".getIndexOnVertices", precice::syncMode);
-    auto                  rtree = mesh::rtree::getVertexRTree(input());
+    auto                  rtree = mesh::rtree::getVertexRTree(input(), _threads);
     e2.stop();
     size_t verticesSize = output()->vertices().size();
     _vertexIndices.resize(verticesSize);
-    utils::statistics::DistanceAccumulator distanceStatistics;
-    const mesh::Mesh::VertexContainer &    outputVertices = output()->vertices();
-    for (size_t i = 0; i < verticesSize; i++) {
-      const Eigen::VectorXd &coords = outputVertices[i].getCoords();
-      // Search for the output vertex inside the input mesh and add index to _vertexIndices
-      rtree->query(boost::geometry::index::nearest(coords, 1),
-                   boost::make_function_output_iterator([&](size_t const &val) {
-                     const auto &match = input()->vertices()[val];
-                     _vertexIndices[i] = match.getID();
-                     distanceStatistics(bg::distance(match, coords));
-                   }));
-    }
-    PRECICE_INFO("Mapping distance " << distanceStatistics);
+    std::vector<double>                distances(verticesSize);
+    const mesh::Mesh::VertexContainer &outputVertices = output()->vertices();
+    const mesh::Mesh::VertexContainer &searchVertices = input()->vertices();
+    utils::parallelFor(verticesSize, _threads, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        const Eigen::VectorXd &coords = outputVertices[i].getCoords();
+        // Search for the output vertex inside the input mesh and add index to _vertexIndices
+        rtree->query(boost::geometry::index::nearest(coords, 1),
+                     boost::make_function_output_iterator([&](size_t const &val) {
+                       const auto &match = searchVertices[val];
+                       _vertexIndices[i] = match.getID();
+                       distances[i]      = bg::distance(match, coords);
+                     }));
+      }
+    });
+    PRECICE_INFO("Mapping distance " << accumulateDistances(distances));
   } else {
     PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
     PRECICE_DEBUG("Compute conservative mapping");
     precice::utils::Event e2(baseEvent + ".getIndexOnVertices", precice::syncMode);
-    auto                  rtree = mesh::rtree::getVertexRTree(output());
+    auto                  rtree = mesh::rtree::getVertexRTree(output(), _threads);
     e2.stop();
     size_t verticesSize = input()->vertices().size();
     _vertexIndices.resize(verticesSize);
-    utils::statistics::DistanceAccumulator distanceStatistics;
-    const mesh::Mesh::VertexContainer &    inputVertices = input()->vertices();
-    for (size_t i = 0; i < verticesSize; i++) {
-      const Eigen::VectorXd &coords = inputVertices[i].getCoords();
-      // Search for the input vertex inside the output mesh and add index to _vertexIndices
-      rtree->query(boost::geometry::index::nearest(coords, 1),
-                   boost::make_function_output_iterator([&](size_t const &val) {
-                     const auto &match = output()->vertices()[val];
-                     _vertexIndices[i] = match.getID();
-                     distanceStatistics(bg::distance(match, coords));
-                   }));
-    }
-    PRECICE_INFO("Mapping distance " << distanceStatistics);
+    std::vector<double>                distances(verticesSize);
+    const mesh::Mesh::VertexContainer &inputVertices  = input()->vertices();
+    const mesh::Mesh::VertexContainer &searchVertices = output()->vertices();
+    utils::parallelFor(verticesSize, _threads, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        const Eigen::VectorXd &coords = inputVertices[i].getCoords();
+        // Search for the input vertex inside the output mesh and add index to _vertexIndices
+        rtree->query(boost::geometry::index::nearest(coords, 1),
+                     boost::make_function_output_iterator([&](size_t const &val) {
+                       const auto &match = searchVertices[val];
+                       _vertexIndices[i] = match.getID();
+                       distances[i]      = bg::distance(match, coords);
+                     }));
+      }
+    });
+    PRECICE_INFO("Mapping distance " << accumulateDistances(distances));
   }
   _hasComputedMapping = true;
+
+  if (getCache()) {
+    getCache()->store(cacheKey, MappingCache::Entry{_vertexIndices, {}});
+  }
+}
+
+bool NearestNeighborMapping::loadFromCache(std::uint64_t key)
+{
+  MappingCache::Entry entry;
+  if (not getCache()->load(key, entry)) {
+    return false;
+  }
+  // The key covers both meshes, this only protects against corrupted entries.
+  const bool   consistent = getConstraint() == CONSISTENT;
+  const size_t fromSize   = consistent ? output()->vertices().size() : input()->vertices().size();
+  const int    toSize     = consistent ? input()->vertices().size() : output()->vertices().size();
+  const bool   valid      = entry.indices.size() == fromSize &&
+                     std::all_of(entry.indices.begin(), entry.indices.end(), [toSize](int index) { return index >= 0 && index < toSize; });
+  if (not valid) {
+    PRECICE_WARN("Ignoring cached mapping, as it does not match the meshes.");
+    return false;
+  }
+  _vertexIndices = std::move(entry.indices);
+  return true;
 }
 
 bool NearestNeighborMapping::hasComputedMapping() const
@@ -88,11 +147,6 @@ void NearestNeighborMapping::clear()
   PRECICE_TRACE();
   _vertexIndices.clear();
   _hasComputedMapping = false;
-  if (getConstraint() == CONSISTENT) {
-    mesh::rtree::clear(*input());
-  } else {
-    mesh::rtree::clear(*output());
-  }
 }
 
 void NearestNeighborMapping::map(
@@ -101,7 +155,7 @@ void NearestNeighborMapping::map(
 {
   PRECICE_TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.nn.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
 
   const Eigen::VectorXd &inputValues  = input()->data(inputDataID)->values();
   Eigen::VectorXd &      outputValues = output()->data(outputDataID)->values();
@@ -140,7 +194,11 @@ void NearestNeighborMapping::tagMeshFirstRound()
   PRECICE_TRACE();
   precice::utils::Event e("map.nn.tagMeshFirstRound.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
+  // The meshes are not filtered yet, so this mapping must not end up in the cache
+  const PtrMappingCache cache = getCache();
+  setCache(nullptr);
   computeMapping();
+  setCache(cache);
 
   // Lookup table of all indices used in the mapping
   const boost::container::flat_set<int> indexSet(_vertexIndices.begin(), _vertexIndices.end());
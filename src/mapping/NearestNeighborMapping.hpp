@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
@@ -15,8 +16,9 @@ public:
    *
    * @param[in] constraint Specifies mapping to be consistent or conservative.
    * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] threads Amount of threads to compute the mapping with, 0 uses all hardware threads
    */
-  NearestNeighborMapping(Constraint constraint, int dimensions);
+  NearestNeighborMapping(Constraint constraint, int dimensions, int threads = 1);
 
   /// Destructor, empty.
   virtual ~NearestNeighborMapping() {}
@@ -46,6 +48,15 @@ private:
 
   /// Computed output vertex indices to map data from input vertices to.
   std::vector<int> _vertexIndices;
+
+  /// Amount of threads used by computeMapping()
+  int _threads;
+
+  /// ID of the event of map(), registered by computeMapping()
+  int _mapDataEvent = -1;
+
+  /// Takes the vertex indices from the cache entry with the given key, if it exists and is valid.
+  bool loadFromCache(std::uint64_t key);
 };
 
 } // namespace mapping
@@ -1,8 +1,10 @@
 #include "NearestProjectionMapping.hpp"
 #include <Eigen/Core>
+#include "mapping/MappingCache.hpp"
 #include "mesh/RTree.hpp"
 #include "query/FindClosest.hpp"
 #include "utils/Event.hpp"
+#include "utils/ParallelFor.hpp"
 #include "utils/Statistics.hpp"
 
 namespace bg  = boost::geometry;
@@ -15,8 +17,10 @@ namespace mapping {
 
 NearestProjectionMapping::NearestProjectionMapping(
     Constraint constraint,
-    int        dimensions)
-    : Mapping(constraint, dimensions)
+    int        dimensions,
+    int        threads)
+    : Mapping(constraint, dimensions),
+      _threads(utils::resolveThreadCount(threads))
 {
   if (constraint == CONSISTENT) {
     setInputRequirement(Mapping::MeshRequirement::FULL);
@@ -41,6 +45,16 @@ struct MatchType {
     return distance < other.distance;
   };
 };
+
+/// Accumulates the distances in order, such that the result does not depend on the amount of threads.
+utils::statistics::DistanceAccumulator accumulateDistances(const std::vector<double> &distances)
+{
+  utils::statistics::DistanceAccumulator distanceStatistics;
+  for (double distance : distances) {
+    distanceStatistics(distance);
+  }
+  return distanceStatistics;
+}
 } // namespace
 
 void NearestProjectionMapping::computeMapping()
@@ -48,6 +62,7 @@ void NearestProjectionMapping::computeMapping()
   PRECICE_TRACE(input()->vertices().size(), output()->vertices().size());
   const std::string     baseEvent = "map.np.computeMapping.From" + input()->getName() + "To" + output()->getName();
   precice::utils::Event e(baseEvent, precice::syncMode);
+  _mapDataEvent = getEventID("map.np.mapData");
 
   // Setup Direction of Mapping
   mesh::PtrMesh origins, search_space;
@@ -65,7 +80,18 @@ void NearestProjectionMapping::computeMapping()
   const auto &tVertices = search_space->vertices();
   const auto &tEdges    = search_space->edges();
 
-  _weights.resize(fVertices.size());
+  std::uint64_t cacheKey = 0;
+  if (getCache()) {
+    const std::string description = "nearest-projection:" + std::to_string(getConstraint()) + ":" + std::to_string(getDimensions());
+    cacheKey                      = MappingCache::computeKey(description, *input(), *output());
+    if (loadFromCache(cacheKey, *origins, *search_space)) {
+      PRECICE_INFO("Loaded mapping from cache " << getCache()->getDirectory());
+      _hasComputedMapping = true;
+      return;
+    }
+  }
+
+  std::vector<InterpolationElements> elements(fVertices.size());
 
   // Amount of nearest elements to fetch for detailed comparison.
   // This safety margin results in a candidate set which forms the base for the
@@ -79,51 +105,58 @@ void NearestProjectionMapping::computeMapping()
     }
 
     precice::utils::Event e2(baseEvent + ".getIndexOnEdges", precice::syncMode);
-    auto                  indexEdges = mesh::rtree::getEdgeRTree(search_space);
+    auto                  indexEdges = mesh::rtree::getEdgeRTree(search_space, _threads);
     e2.stop();
 
     // Lazy evaluation of the vertex index.
     // This is not necessary in the case of matching meshes.
+    // Building it lazily is not thread-safe, hence it is built upfront when using threads.
     mesh::rtree::vertex_traits::Ptr indexVertices;
+    if (_threads > 1) {
+      precice::utils::Event e3(baseEvent + ".getIndexOnVertices", precice::syncMode);
+      indexVertices = mesh::rtree::getVertexRTree(search_space, _threads);
+    }
+
+    std::vector<double> distances(fVertices.size());
 
-    utils::statistics::DistanceAccumulator distanceStatistics;
-
-    std::vector<MatchType> matches;
-    matches.reserve(nnearest);
-    for (size_t i = 0; i < fVertices.size(); i++) {
-      const Eigen::VectorXd &coords = fVertices[i].getCoords();
-      // Search for the origin inside the destination meshes edges
-      matches.clear();
-      indexEdges->query(bg::index::nearest(coords, nnearest),
-                        boost::make_function_output_iterator([&](int match) {
-                          matches.emplace_back(bg::distance(coords, tEdges[match]), match);
-                        }));
-      std::sort(matches.begin(), matches.end());
-      bool found = false;
-      for (const auto &match : matches) {
-        auto weights = query::generateInterpolationElements(fVertices[i], tEdges[match.index]);
-        if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
-          _weights[i] = std::move(weights);
-          distanceStatistics(match.distance);
-          found = true;
-          break;
+    utils::parallelFor(fVertices.size(), _threads, [&](size_t begin, size_t end) {
+      std::vector<MatchType> matches;
+      matches.reserve(nnearest);
+      for (size_t i = begin; i < end; i++) {
+        const Eigen::VectorXd &coords = fVertices[i].getCoords();
+        // Search for the origin inside the destination meshes edges
+        matches.clear();
+        indexEdges->query(bg::index::nearest(coords, nnearest),
+                          boost::make_function_output_iterator([&](int match) {
+                            matches.emplace_back(bg::distance(coords, tEdges[match]), match);
+                          }));
+        std::sort(matches.begin(), matches.end());
+        bool found = false;
+        for (const auto &match : matches) {
+          auto weights = query::generateInterpolationElements(fVertices[i], tEdges[match.index]);
+          if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
+            elements[i]  = std::move(weights);
+            distances[i] = match.distance;
+            found        = true;
+            break;
+          }
         }
-      }
 
-      if (not found) {
-        if (!indexVertices) {
-          precice::utils::Event e3(baseEvent + ".getIndexOnVertices", precice::syncMode);
-          indexVertices = mesh::rtree::getVertexRTree(search_space);
+        if (not found) {
+          if (!indexVertices) {
+            precice::utils::Event e3(baseEvent + ".getIndexOnVertices", precice::syncMode);
+            indexVertices = mesh::rtree::getVertexRTree(search_space);
+          }
+          // Search for the origin inside the destination meshes vertices
+          indexVertices->query(bg::index::nearest(coords, 1),
+                               boost::make_function_output_iterator([&](int match) {
+                                 elements[i]  = query::generateInterpolationElements(fVertices[i], tVertices[match]);
+                                 distances[i] = bg::distance(fVertices[i], tVertices[match]);
+                               }));
         }
-        // Search for the origin inside the destination meshes vertices
-        indexVertices->query(bg::index::nearest(coords, 1),
-                             boost::make_function_output_iterator([&](int match) {
-                               _weights[i] = query::generateInterpolationElements(fVertices[i], tVertices[match]);
-                               distanceStatistics(bg::distance(fVertices[i], tVertices[match]));
-                             }));
       }
-    }
-    PRECICE_INFO("Mapping distance " << distanceStatistics);
+    });
+    PRECICE_INFO("Mapping distance " << accumulateDistances(distances));
   } else {
     const auto &tTriangles = search_space->triangles();
     if (!fVertices.empty() && tTriangles.empty()) {
@@ -131,78 +164,148 @@ void NearestProjectionMapping::computeMapping()
     }
 
     precice::utils::Event e2(baseEvent + ".getIndexOnTriangles", precice::syncMode);
-    auto                  indexTriangles = mesh::rtree::getTriangleRTree(search_space);
+    auto                  indexTriangles = mesh::rtree::getTriangleRTree(search_space, _threads);
     e2.stop();
 
     // Lazy evaluation of indices for edges and vertices.
     // These are not necessary in the case of matching meshes.
+    // Building them lazily is not thread-safe, hence they are built upfront when using threads.
     mesh::rtree::edge_traits::Ptr   indexEdges;
     mesh::rtree::vertex_traits::Ptr indexVertices;
+    if (_threads > 1) {
+      precice::utils::Event e3(baseEvent + ".getIndexOnEdges", precice::syncMode);
+      indexEdges = mesh::rtree::getEdgeRTree(search_space, _threads);
+      e3.stop();
+      precice::utils::Event e4(baseEvent + ".getIndexOnVertices", precice::syncMode);
+      indexVertices = mesh::rtree::getVertexRTree(search_space, _threads);
+    }
 
-    utils::statistics::DistanceAccumulator distanceStatistics;
-
-    std::vector<MatchType> matches;
-    matches.reserve(nnearest);
-    for (size_t i = 0; i < fVertices.size(); i++) {
-      const Eigen::VectorXd &coords = fVertices[i].getCoords();
+    std::vector<double> distances(fVertices.size());
 
-      // Search for the vertex inside the destination meshes triangles
-      matches.clear();
-      indexTriangles->query(bg::index::nearest(coords, nnearest),
-                            boost::make_function_output_iterator([&](mesh::rtree::triangle_traits::IndexType const &match) {
-                              matches.emplace_back(bg::distance(coords, tTriangles[match.second]), match.second);
-                            }));
-      std::sort(matches.begin(), matches.end());
-      bool found = false;
-      for (const auto &match : matches) {
-        auto weights = query::generateInterpolationElements(fVertices[i], tTriangles[match.index]);
-        if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
-          _weights[i] = std::move(weights);
-          found       = true;
-          distanceStatistics(match.distance);
-          break;
-        }
-      }
+    utils::parallelFor(fVertices.size(), _threads, [&](size_t begin, size_t end) {
+      std::vector<MatchType> matches;
+      matches.reserve(nnearest);
+      for (size_t i = begin; i < end; i++) {
+        const Eigen::VectorXd &coords = fVertices[i].getCoords();
 
-      if (not found) {
-        if (!indexEdges) {
-          precice::utils::Event e3(baseEvent + ".getIndexOnEdges", precice::syncMode);
-          indexEdges = mesh::rtree::getEdgeRTree(search_space);
-        }
-        // Search for the vertex inside the destination meshes edges
+        // Search for the vertex inside the destination meshes triangles
         matches.clear();
-        indexEdges->query(bg::index::nearest(coords, nnearest),
-                          boost::make_function_output_iterator([&](int match) {
-                            matches.emplace_back(bg::distance(coords, tEdges[match]), match);
-                          }));
+        indexTriangles->query(bg::index::nearest(coords, nnearest),
+                              boost::make_function_output_iterator([&](mesh::rtree::triangle_traits::IndexType const &match) {
+                                matches.emplace_back(bg::distance(coords, tTriangles[match.second]), match.second);
+                              }));
         std::sort(matches.begin(), matches.end());
+        bool found = false;
         for (const auto &match : matches) {
-          auto weights = query::generateInterpolationElements(fVertices[i], tEdges[match.index]);
+          auto weights = query::generateInterpolationElements(fVertices[i], tTriangles[match.index]);
           if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
-            _weights[i] = std::move(weights);
-            found       = true;
-            distanceStatistics(match.distance);
+            elements[i]  = std::move(weights);
+            found        = true;
+            distances[i] = match.distance;
             break;
           }
         }
-      }
 
-      if (not found) {
-        if (!indexVertices) {
-          precice::utils::Event e4(baseEvent + ".getIndexOnVertices", precice::syncMode);
-          indexVertices = mesh::rtree::getVertexRTree(search_space);
+        if (not found) {
+          if (!indexEdges) {
+            precice::utils::Event e3(baseEvent + ".getIndexOnEdges", precice::syncMode);
+            indexEdges = mesh::rtree::getEdgeRTree(search_space);
+          }
+          // Search for the vertex inside the destination meshes edges
+          matches.clear();
+          indexEdges->query(bg::index::nearest(coords, nnearest),
+                            boost::make_function_output_iterator([&](int match) {
+                              matches.emplace_back(bg::distance(coords, tEdges[match]), match);
+                            }));
+          std::sort(matches.begin(), matches.end());
+          for (const auto &match : matches) {
+            auto weights = query::generateInterpolationElements(fVertices[i], tEdges[match.index]);
+            if (std::all_of(weights.begin(), weights.end(), [](query::InterpolationElement const &elem) { return elem.weight >= 0.0; })) {
+              elements[i]  = std::move(weights);
+              found        = true;
+              distances[i] = match.distance;
+              break;
+            }
+          }
+        }
+
+        if (not found) {
+          if (!indexVertices) {
+            precice::utils::Event e4(baseEvent + ".getIndexOnVertices", precice::syncMode);
+            indexVertices = mesh::rtree::getVertexRTree(search_space);
+          }
+          // Search for the vertex inside the destination meshes vertices
+          indexVertices->query(bg::index::nearest(coords, 1),
+                               boost::make_function_output_iterator([&](int match) {
+                                 elements[i]  = query::generateInterpolationElements(fVertices[i], tVertices[match]);
+                                 distances[i] = bg::distance(fVertices[i], tVertices[match]);
+                               }));
         }
-        // Search for the vertex inside the destination meshes vertices
-        indexVertices->query(bg::index::nearest(coords, 1),
-                             boost::make_function_output_iterator([&](int match) {
-                               _weights[i] = query::generateInterpolationElements(fVertices[i], tVertices[match]);
-                               distanceStatistics(bg::distance(fVertices[i], tVertices[match]));
-                             }));
       }
+    });
+    PRECICE_INFO("Mapping distance " << accumulateDistances(distances));
+  }
+
+  std::vector<Eigen::Triplet<double>> entries;
+  for (size_t i = 0; i < elements.size(); i++) {
+    for (const query::InterpolationElement &elem : elements[i]) {
+      entries.emplace_back(i, elem.element->getID(), elem.weight);
     }
-    PRECICE_INFO("Mapping distance " << distanceStatistics);
   }
+  _operator.resize(fVertices.size(), tVertices.size());
+  _operator.setFromTriplets(entries.begin(), entries.end());
   _hasComputedMapping = true;
+
+  if (getCache()) {
+    storeInCache(cacheKey);
+  }
+}
+
+bool NearestProjectionMapping::loadFromCache(std::uint64_t key, const mesh::Mesh &origins, const mesh::Mesh &searchSpace)
+{
+  MappingCache::Entry entry;
+  if (not getCache()->load(key, entry)) {
+    return false;
+  }
+
+  // The entry holds the count followed by the vertex IDs of the elements of
+  // every origin vertex, and the corresponding weights.
+  const size_t                        rows = origins.vertices().size();
+  const size_t                        cols = searchSpace.vertices().size();
+  std::vector<Eigen::Triplet<double>> entries;
+  size_t                              index = 0, value = 0;
+  bool                                valid = true;
+  for (size_t i = 0; valid && i < rows; i++) {
+    const int count = index < entry.indices.size() ? entry.indices[index++] : -1;
+    valid           = count >= 0 && index + count <= entry.indices.size() && value + count <= entry.values.size();
+    for (int j = 0; valid && j < count; j++) {
+      const int id = entry.indices[index++];
+      valid        = id >= 0 && static_cast<size_t>(id) < cols;
+      if (valid) {
+        entries.emplace_back(i, id, entry.values[value++]);
+      }
+    }
+  }
+  if (not valid || index != entry.indices.size() || value != entry.values.size()) {
+    PRECICE_WARN("Ignoring cached mapping, as it does not match the meshes.");
+    return false;
+  }
+  _operator.resize(rows, cols);
+  _operator.setFromTriplets(entries.begin(), entries.end());
+  return true;
+}
+
+void NearestProjectionMapping::storeInCache(std::uint64_t key) const
+{
+  MappingCache::Entry entry;
+  for (Operator::Index row = 0; row < _operator.outerSize(); row++) {
+    entry.indices.push_back(_operator.outerIndexPtr()[row + 1] - _operator.outerIndexPtr()[row]);
+    for (Operator::InnerIterator it(_operator, row); it; ++it) {
+      entry.indices.push_back(it.col());
+      entry.values.push_back(it.value());
+    }
+  }
+  getCache()->store(key, entry);
 }
 
 bool NearestProjectionMapping::hasComputedMapping() const
@@ -213,7 +316,7 @@ bool NearestProjectionMapping::hasComputedMapping() const
 void NearestProjectionMapping::clear()
 {
   PRECICE_TRACE();
-  _weights.clear();
+  _operator           = Operator();
   _hasComputedMapping = false;
 }
 
@@ -223,49 +326,31 @@ void NearestProjectionMapping::map(
 {
   PRECICE_TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.np.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
 
-  mesh::PtrData          inData    = input()->data(inputDataID);
-  mesh::PtrData          outData   = output()->data(outputDataID);
-  const Eigen::VectorXd &inValues  = inData->values();
-  Eigen::VectorXd &      outValues = outData->values();
-  //assign(outValues) = 0.0;
-  int dimensions = inData->getDimensions();
+  mesh::PtrData inData     = input()->data(inputDataID);
+  mesh::PtrData outData    = output()->data(outputDataID);
+  int           dimensions = inData->getDimensions();
   PRECICE_ASSERT(dimensions == outData->getDimensions());
 
+  // The values of all components are mapped at once, viewing them as one row per vertex.
+  using ValuesMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  const Eigen::VectorXd &        inValues  = inData->values();
+  Eigen::VectorXd &              outValues = outData->values();
+  Eigen::Map<const ValuesMatrix> in(inValues.data(), inValues.size() / dimensions, dimensions);
+  Eigen::Map<ValuesMatrix>       out(outValues.data(), outValues.size() / dimensions, dimensions);
+
   if (getConstraint() == CONSISTENT) {
     PRECICE_DEBUG("Map consistent");
-    PRECICE_ASSERT(_weights.size() == output()->vertices().size(),
-                   _weights.size(), output()->vertices().size());
-    for (size_t i = 0; i < output()->vertices().size(); i++) {
-      InterpolationElements &elems     = _weights[i];
-      size_t                 outOffset = i * dimensions;
-      for (query::InterpolationElement &elem : elems) {
-        size_t inOffset = (size_t) elem.element->getID() * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
+    PRECICE_ASSERT(_operator.rows() == out.rows(), _operator.rows(), out.rows());
+    PRECICE_ASSERT(_operator.cols() == in.rows(), _operator.cols(), in.rows());
+    out.noalias() += _operator * in;
   } else {
     PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
     PRECICE_DEBUG("Map conservative");
-    PRECICE_ASSERT(_weights.size() == input()->vertices().size(),
-                   _weights.size(), input()->vertices().size());
-    for (size_t i = 0; i < input()->vertices().size(); i++) {
-      size_t                 inOffset = i * dimensions;
-      InterpolationElements &elems    = _weights[i];
-      for (query::InterpolationElement &elem : elems) {
-        size_t outOffset = (size_t) elem.element->getID() * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
+    PRECICE_ASSERT(_operator.rows() == in.rows(), _operator.rows(), in.rows());
+    PRECICE_ASSERT(_operator.cols() == out.rows(), _operator.cols(), out.rows());
+    out.noalias() += _operator.transpose() * in;
   }
 }
 
@@ -275,7 +360,11 @@ void NearestProjectionMapping::tagMeshFirstRound()
   precice::utils::Event e("map.np.tagMeshFirstRound.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
   PRECICE_DEBUG("Compute Mapping for Tagging");
 
+  // The meshes are not filtered yet, so this mapping must not end up in the cache
+  const PtrMappingCache cache = getCache();
+  setCache(nullptr);
   computeMapping();
+  setCache(cache);
   PRECICE_DEBUG("Tagging First Round");
 
   // Determine the Mesh to Tag
@@ -289,13 +378,13 @@ void NearestProjectionMapping::tagMeshFirstRound()
 
   // Gather all vertices to be tagged in a first phase.
   // max_count is used to shortcut if all vertices have been tagged.
-  std::unordered_set<mesh::Vertex const *> tagged;
-  const std::size_t                        max_count = origins->vertices().size();
+  std::unordered_set<int> tagged;
+  const std::size_t       max_count = origins->vertices().size();
 
-  for (const InterpolationElements &elems : _weights) {
-    for (const query::InterpolationElement &elem : elems) {
-      if (!math::equals(elem.weight, 0.0)) {
-        tagged.insert(elem.element);
+  for (Operator::Index row = 0; row < _operator.outerSize(); row++) {
+    for (Operator::InnerIterator it(_operator, row); it; ++it) {
+      if (!math::equals(it.value(), 0.0)) {
+        tagged.insert(it.col());
       }
     }
     // Shortcut if all vertices are tagged
@@ -306,7 +395,7 @@ void NearestProjectionMapping::tagMeshFirstRound()
 
   // Now tag all vertices to be tagged in the second phase.
   for (auto &v : origins->vertices()) {
-    if (tagged.count(&v) == 1) {
+    if (tagged.count(v.getID()) == 1) {
       v.tag();
     }
   }
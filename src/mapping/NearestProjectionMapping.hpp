@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Eigen/SparseCore>
+#include <cstdint>
 #include <list>
 #include <vector>
 #include "Mapping.hpp"
@@ -15,8 +17,8 @@ namespace mapping {
  */
 class NearestProjectionMapping : public Mapping {
 public:
-  /// Constructor, taking mapping constraint.
-  NearestProjectionMapping(Constraint constraint, int dimensions);
+  /// Constructor, taking mapping constraint and the amount of threads to compute the mapping with (0 uses all hardware threads).
+  NearestProjectionMapping(Constraint constraint, int dimensions, int threads = 1);
 
   /// Destructor, empty.
   virtual ~NearestProjectionMapping() {}
@@ -49,9 +51,31 @@ private:
   logging::Logger _log{"mapping::NearestProjectionMapping"};
 
   using InterpolationElements = std::vector<query::InterpolationElement>;
-  std::vector<InterpolationElements> _weights;
+
+  using Operator = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+  /**
+   * @brief Interpolation weights in compressed row storage.
+   *
+   * Row i holds the weights of the i-th origin vertex with respect to the vertices
+   * of the search space, i.e., the output vertices are rows for a consistent and
+   * columns for a conservative mapping.
+   */
+  Operator _operator;
 
   bool _hasComputedMapping = false;
+
+  /// Amount of threads used by computeMapping()
+  int _threads;
+
+  /// ID of the event of map(), registered by computeMapping()
+  int _mapDataEvent = -1;
+
+  /// Takes the weights from the cache entry with the given key, if it exists and is valid.
+  bool loadFromCache(std::uint64_t key, const mesh::Mesh &origins, const mesh::Mesh &searchSpace);
+
+  /// Stores the computed weights under the given key in the cache.
+  void storeInCache(std::uint64_t key) const;
 };
 
 } // namespace mapping
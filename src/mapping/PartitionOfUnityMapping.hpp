@@ -0,0 +1,456 @@
+#pragma once
+
+#include "Mapping.hpp"
+#include "impl/BasisFunctions.hpp"
+#include "mesh/RTree.hpp"
+#include "utils/Event.hpp"
+#include "utils/ParallelFor.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <Eigen/SparseCore>
+#include <algorithm>
+#include <boost/function_output_iterator.hpp>
+#include <vector>
+
+namespace precice {
+extern bool syncMode;
+
+namespace mapping {
+
+/**
+ * @brief Mapping with radial basis functions on overlapping patches, blended by a partition of unity.
+ *
+ * The input mesh is covered by overlapping spherical patches. Every patch is
+ * centered at an input vertex, contains its nearest input vertices, found via
+ * the vertex R-tree of the input mesh, and is enlarged by a relative overlap.
+ * Each patch solves a small dense RBF system with a linear polynomial.
+ *
+ * The value at an output vertex is the sum of the interpolants of all patches
+ * containing it, weighted by Wendland C2 functions of the distance to the
+ * patch centers, normalized to sum up to one. Output vertices outside of all
+ * patches are evaluated on the nearest patch.
+ *
+ * There is no global system. The patches are independent and computed on
+ * multiple threads, and in parallel runs every rank only treats its local
+ * meshes. The resulting operator is stored as a sparse matrix.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class PartitionOfUnityMapping : public Mapping {
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used on every patch.
+   * @param[in] verticesPerPatch Amount of input vertices in the core of every patch
+   * @param[in] relativeOverlap Enlargement of the patch radius relative to the radius of its core
+   * @param[in] threads Amount of threads to compute the mapping with, 0 uses all hardware threads
+   */
+  PartitionOfUnityMapping(
+      Constraint              constraint,
+      int                     dimensions,
+      RADIAL_BASIS_FUNCTION_T function,
+      int                     verticesPerPatch,
+      double                  relativeOverlap,
+      int                     threads = 1);
+
+  /// Computes the mapping coefficients from the in- and output mesh.
+  virtual void computeMapping() override;
+
+  /// Returns true, if computeMapping() has been called.
+  virtual bool hasComputedMapping() const override;
+
+  /// Removes a computed mapping.
+  virtual void clear() override;
+
+  /// Maps input data to output data from input mesh to output mesh.
+  virtual void map(int inputDataID, int outputDataID) override;
+
+  /// Tags all vertices of the remote mesh which contribute to the mapping.
+  virtual void tagMeshFirstRound() override;
+
+  /// Nothing to do here, as the first round already tags all required vertices.
+  virtual void tagMeshSecondRound() override;
+
+private:
+  /// Input vertices interpolated together, given as indices into the vertices of the input mesh.
+  struct Patch {
+    size_t              center;
+    double              radius;
+    std::vector<size_t> vertices;
+  };
+
+  /// An output vertex evaluated on a patch, given as index and partition of unity weight.
+  using WeightedVertex = std::pair<size_t, double>;
+
+  precice::logging::Logger _log{"mapping::PartitionOfUnityMapping"};
+
+  bool _hasComputedMapping = false;
+
+  /// ID of the event of map(), registered by computeMapping()
+  int _mapDataEvent = -1;
+
+  /// Radial basis function type used on every patch.
+  RADIAL_BASIS_FUNCTION_T _basisFunction;
+
+  int _verticesPerPatch;
+
+  double _relativeOverlap;
+
+  int _threads;
+
+  /// Rows are the vertices of the mesh mapped to, i.e., the operator is transposed for conservative mappings.
+  Eigen::SparseMatrix<double, Eigen::RowMajor> _operator;
+
+  /// Covers all vertices of the given mesh by patches.
+  std::vector<Patch> createPatches(const mesh::PtrMesh &inMesh, const Eigen::MatrixXd &inCoords) const;
+
+  /// Returns the output vertices evaluated on each patch.
+  std::vector<std::vector<WeightedVertex>> assignVertices(
+      const std::vector<Patch> &patches,
+      const mesh::PtrMesh &     inMesh,
+      const Eigen::MatrixXd &   inCoords,
+      const mesh::PtrMesh &     outMesh,
+      const Eigen::MatrixXd &   outCoords) const;
+
+  /// Solves the RBF system of a patch and appends its weighted evaluation at the given output vertices.
+  void computePatchOperator(
+      const Patch &                      patch,
+      const std::vector<WeightedVertex> &outputs,
+      const Eigen::MatrixXd &            inCoords,
+      const Eigen::MatrixXd &            outCoords,
+      std::vector<Eigen::Triplet<double>> &entries) const;
+
+  /// Wendland C2 function, which decays from 1 at the center to 0 at the radius.
+  static double weight(double distance, double radius);
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::PartitionOfUnityMapping(
+    Constraint              constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    int                     verticesPerPatch,
+    double                  relativeOverlap,
+    int                     threads)
+    : Mapping(constraint, dimensions),
+      _basisFunction(function),
+      _verticesPerPatch(verticesPerPatch),
+      _relativeOverlap(relativeOverlap),
+      _threads(utils::resolveThreadCount(threads))
+{
+  PRECICE_CHECK(_verticesPerPatch > 0, "The vertices per patch of a partition of unity mapping have to be positive, but are " << _verticesPerPatch << ".");
+  PRECICE_CHECK(_relativeOverlap >= 0.0, "The relative overlap of a partition of unity mapping has to be non-negative, but is " << _relativeOverlap << ".");
+  setInputRequirement(Mapping::MeshRequirement::VERTEX);
+  setOutputRequirement(Mapping::MeshRequirement::VERTEX);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
+{
+  PRECICE_TRACE();
+  precice::utils::Event e("map.pou.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  _mapDataEvent = getEventID("map.pou.mapData");
+
+  PRECICE_ASSERT(input()->getDimensions() == output()->getDimensions(),
+                 input()->getDimensions(), output()->getDimensions());
+  mesh::PtrMesh inMesh;
+  mesh::PtrMesh outMesh;
+  if (getConstraint() == CONSERVATIVE) {
+    inMesh  = output();
+    outMesh = input();
+  } else {
+    inMesh  = input();
+    outMesh = output();
+  }
+
+  _operator = Eigen::SparseMatrix<double, Eigen::RowMajor>(outMesh->vertices().size(), inMesh->vertices().size());
+  if (inMesh->vertices().empty() || outMesh->vertices().empty()) {
+    _hasComputedMapping = true;
+    return;
+  }
+
+  const Eigen::MatrixXd inCoords  = inMesh->getVertexCoordinates();
+  const Eigen::MatrixXd outCoords = outMesh->getVertexCoordinates();
+
+  precice::utils::Event eCover("map.pou.createPatches.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  const std::vector<Patch> patches = createPatches(inMesh, inCoords);
+  const auto               outputs = assignVertices(patches, inMesh, inCoords, outMesh, outCoords);
+  eCover.addData("Patches", static_cast<int>(patches.size()));
+  eCover.stop();
+
+  // The patches are independent, hence every one collects its own entries
+  precice::utils::Event                            eSolve("map.pou.solvePatches.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  std::vector<std::vector<Eigen::Triplet<double>>> patchEntries(patches.size());
+  utils::parallelFor(patches.size(), _threads, [&](size_t begin, size_t end) {
+    for (size_t p = begin; p < end; p++) {
+      computePatchOperator(patches[p], outputs[p], inCoords, outCoords, patchEntries[p]);
+    }
+  });
+
+  std::vector<Eigen::Triplet<double>> entries;
+  size_t                              nonZeros = 0;
+  for (const auto &patchEntry : patchEntries) {
+    nonZeros += patchEntry.size();
+  }
+  entries.reserve(nonZeros);
+  for (auto &patchEntry : patchEntries) {
+    entries.insert(entries.end(), patchEntry.begin(), patchEntry.end());
+    patchEntry = std::vector<Eigen::Triplet<double>>();
+  }
+  // Entries of vertices in several patches are summed up
+  _operator.setFromTriplets(entries.begin(), entries.end());
+  eSolve.addData("NonZeros", static_cast<int>(_operator.nonZeros()));
+
+  _hasComputedMapping = true;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<typename PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::Patch>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::createPatches(
+    const mesh::PtrMesh &  inMesh,
+    const Eigen::MatrixXd &inCoords) const
+{
+  namespace bgi        = boost::geometry::index;
+  auto         tree    = mesh::rtree::getVertexRTree(inMesh, _threads);
+  const size_t size    = inCoords.cols();
+  const size_t nearest = std::min<size_t>(_verticesPerPatch, size);
+
+  // Every vertex not yet in the core of a patch becomes the center of a new one.
+  // The core of a patch are the nearest vertices of its center, while the overlap
+  // adds vertices of neighboring cores.
+  std::vector<Patch> patches;
+  std::vector<bool>  covered(size, false);
+  for (size_t i = 0; i < size; i++) {
+    if (covered[i])
+      continue;
+    const mesh::Vertex &center     = inMesh->vertices()[i];
+    double              coreRadius = 0.0;
+    tree->query(bgi::nearest(center.getCoords(), nearest),
+                boost::make_function_output_iterator([&](size_t match) {
+                  covered[match] = true;
+                  coreRadius     = std::max(coreRadius, (inCoords.col(match) - inCoords.col(i)).norm());
+                }));
+
+    Patch patch;
+    patch.center = i;
+    patch.radius = coreRadius * (1.0 + _relativeOverlap);
+    tree->query(bgi::intersects(mesh::getEnclosingBox(center, patch.radius)),
+                boost::make_function_output_iterator([&](size_t match) {
+                  if ((inCoords.col(match) - inCoords.col(i)).norm() <= patch.radius)
+                    patch.vertices.push_back(match);
+                }));
+    std::sort(patch.vertices.begin(), patch.vertices.end());
+    patches.push_back(std::move(patch));
+  }
+  return patches;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<std::vector<typename PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::WeightedVertex>>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::assignVertices(
+    const std::vector<Patch> &patches,
+    const mesh::PtrMesh &     inMesh,
+    const Eigen::MatrixXd &   inCoords,
+    const mesh::PtrMesh &     outMesh,
+    const Eigen::MatrixXd &   outCoords) const
+{
+  namespace bgi    = boost::geometry::index;
+  using PatchValue = std::pair<mesh::Box3d, size_t>;
+
+  std::vector<PatchValue> values(patches.size());
+  for (size_t p = 0; p < patches.size(); p++) {
+    values[p] = std::make_pair(mesh::getEnclosingBox(inMesh->vertices()[patches[p].center], patches[p].radius), p);
+  }
+  const bgi::rtree<PatchValue, mesh::RTreeParameters> patchTree(values);
+
+  // Weights of all patches evaluated at each output vertex
+  const size_t                             outputSize = outCoords.cols();
+  std::vector<std::vector<WeightedVertex>> weights(outputSize);
+  utils::parallelFor(outputSize, _threads, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      const Eigen::VectorXd &coords = outMesh->vertices()[i].getCoords();
+      double                 sum    = 0.0;
+      patchTree.query(bgi::intersects(coords),
+                      boost::make_function_output_iterator([&](PatchValue const &match) {
+                        const Patch &patch    = patches[match.second];
+                        const double distance = (outCoords.col(i) - inCoords.col(patch.center)).norm();
+                        if (distance < patch.radius) {
+                          const double w = weight(distance, patch.radius);
+                          weights[i].emplace_back(match.second, w);
+                          sum += w;
+                        }
+                      }));
+      if (weights[i].empty()) {
+        patchTree.query(bgi::nearest(coords, 1),
+                        boost::make_function_output_iterator([&](PatchValue const &match) {
+                          weights[i].emplace_back(match.second, 1.0);
+                        }));
+        sum = 1.0;
+      }
+      for (auto &w : weights[i]) {
+        w.second /= sum;
+      }
+    }
+  });
+
+  std::vector<std::vector<WeightedVertex>> outputs(patches.size());
+  for (size_t i = 0; i < outputSize; i++) {
+    for (const auto &w : weights[i]) {
+      outputs[w.first].emplace_back(i, w.second);
+    }
+  }
+  return outputs;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computePatchOperator(
+    const Patch &                        patch,
+    const std::vector<WeightedVertex> &  outputs,
+    const Eigen::MatrixXd &              inCoords,
+    const Eigen::MatrixXd &              outCoords,
+    std::vector<Eigen::Triplet<double>> &entries) const
+{
+  if (outputs.empty())
+    return;
+
+  const int dimensions = inCoords.rows();
+  const int size       = patch.vertices.size();
+  // A linear polynomial is only added if the patch holds enough vertices to determine it
+  const int polyparams = size > dimensions + 1 ? 1 + dimensions : 0;
+  const int n          = size + polyparams;
+
+  // Coordinates relative to the center improve the conditioning of the polynomial
+  Eigen::MatrixXd local(dimensions, size);
+  for (int j = 0; j < size; j++) {
+    local.col(j) = inCoords.col(patch.vertices[j]) - inCoords.col(patch.center);
+  }
+
+  Eigen::MatrixXd matrixC = Eigen::MatrixXd::Zero(n, n);
+  for (int i = 0; i < size; i++) {
+    for (int j = i; j < size; j++) {
+      matrixC(i, j) = matrixC(j, i) = _basisFunction.evaluate((local.col(i) - local.col(j)).norm());
+    }
+    if (polyparams > 0) {
+      matrixC(i, size) = matrixC(size, i) = 1.0;
+      matrixC.block(i, size + 1, 1, dimensions) = local.col(i).transpose();
+      matrixC.block(size + 1, i, dimensions, 1) = local.col(i);
+    }
+  }
+
+  // Evaluation matrix, transposed to solve for all outputs at once
+  Eigen::MatrixXd matrixAT(n, outputs.size());
+  for (size_t k = 0; k < outputs.size(); k++) {
+    const Eigen::VectorXd coords = outCoords.col(outputs[k].first) - inCoords.col(patch.center);
+    for (int j = 0; j < size; j++) {
+      matrixAT(j, k) = _basisFunction.evaluate((coords - local.col(j)).norm());
+    }
+    if (polyparams > 0) {
+      matrixAT(size, k)                           = 1.0;
+      matrixAT.block(size + 1, k, dimensions, 1) = coords;
+    }
+  }
+
+  // C is symmetric, hence the rows of A C^-1 are the columns of C^-1 A^T.
+  // The rank revealing QR decomposition copes with degenerate polynomials, e.g., on planar patches.
+  const Eigen::MatrixXd weights = matrixC.colPivHouseholderQr().solve(matrixAT);
+
+  entries.reserve(entries.size() + outputs.size() * size);
+  for (size_t k = 0; k < outputs.size(); k++) {
+    for (int j = 0; j < size; j++) {
+      entries.emplace_back(outputs[k].first, patch.vertices[j], outputs[k].second * weights(j, k));
+    }
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+double PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::weight(double distance, double radius)
+{
+  const double t = distance / radius;
+  if (t >= 1.0)
+    return 0.0;
+  return std::pow(1.0 - t, 4) * (4.0 * t + 1.0);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::hasComputedMapping() const
+{
+  return _hasComputedMapping;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  PRECICE_TRACE();
+  _operator           = Eigen::SparseMatrix<double, Eigen::RowMajor>();
+  _hasComputedMapping = false;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::map(
+    int inputDataID,
+    int outputDataID)
+{
+  PRECICE_TRACE(inputDataID, outputDataID);
+
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
+
+  PRECICE_ASSERT(_hasComputedMapping);
+  using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  const Eigen::VectorXd &inValues  = input()->data(inputDataID)->values();
+  Eigen::VectorXd &      outValues = output()->data(outputDataID)->values();
+  const int              valueDim  = input()->data(inputDataID)->getDimensions();
+  PRECICE_ASSERT(valueDim == output()->data(outputDataID)->getDimensions(),
+                 valueDim, output()->data(outputDataID)->getDimensions());
+
+  // Every component of the data is mapped as one column
+  Eigen::Map<const RowMajorMatrix> in(inValues.data(), input()->vertices().size(), valueDim);
+  Eigen::Map<RowMajorMatrix>       out(outValues.data(), output()->vertices().size(), valueDim);
+  if (getConstraint() == CONSISTENT) {
+    PRECICE_DEBUG("Map consistent");
+    out = _operator * in;
+  } else {
+    PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
+    PRECICE_DEBUG("Map conservative");
+    out = _operator.transpose() * in;
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
+{
+  PRECICE_TRACE();
+  precice::utils::Event e("map.pou.tagMeshFirstRound.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  computeMapping();
+
+  // The columns of the operator refer to the vertices of the remote mesh
+  mesh::PtrMesh     filterMesh = getConstraint() == CONSISTENT ? input() : output();
+  std::vector<bool> used(filterMesh->vertices().size(), false);
+  for (int row = 0; row < _operator.outerSize(); row++) {
+    for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(_operator, row); it; ++it) {
+      used[it.col()] = true;
+    }
+  }
+  for (size_t i = 0; i < used.size(); i++) {
+    if (used[i])
+      filterMesh->vertices()[i].tag();
+  }
+
+  clear();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
+{
+  PRECICE_TRACE();
+  // The first round already tagged all vertices used by the patches
+}
+
+} // namespace mapping
+} // namespace precice
@@ -3,7 +3,10 @@
 
 #include "mapping/Mapping.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <map>
+#include <mutex>
 #include <numeric>
 #include <vector>
 
@@ -15,13 +18,15 @@
 #include "utils/Petsc.hpp"
 namespace petsc = precice::utils::petsc;
 #include "utils/Event.hpp"
+#include "utils/ParallelFor.hpp"
 
 // Forward declaration to friend the boost test struct
 namespace MappingTests {
 namespace PetRadialBasisFunctionMapping {
 namespace Serial {
 struct SolutionCaching;
-}
+struct ReuseUnchangedMeshes;
+} // namespace Serial
 } // namespace PetRadialBasisFunctionMapping
 } // namespace MappingTests
 
@@ -60,6 +65,8 @@ public:
    * @param[in] solverRtol Relative tolerance for the linear solver.
    * @param[in] polynomial Type of polynomial augmentation
    * @param[in] preallocation Sets kind of preallocation of matrices.
+   * @param[in] threads Amount of threads to assemble the matrices with, 0 uses all hardware threads
+   * @param[in] solverPreset Solver and preconditioner of the interpolation system
    *
    * For description on convergence testing and meaning of solverRtol see http://www.mcs.anl.gov/petsc/petsc-current/docs/manualpages/KSP/KSPConvergedDefault.html#KSPConvergedDefault
    */
@@ -72,43 +79,64 @@ public:
       bool                           zDead,
       double                         solverRtol    = 1e-9,
       Polynomial                     polynomial    = Polynomial::SEPARATE,
-      Preallocation                  preallocation = Preallocation::TREE);
+      Preallocation                  preallocation = Preallocation::TREE,
+      int                            threads       = 1,
+      SolverPreset                   solverPreset  = SolverPreset::DEFAULT);
 
   /// Deletes the PETSc objects and the _deadAxis array
   virtual ~PetRadialBasisFctMapping();
 
-  /// Computes the mapping coefficients from the in- and output mesh.
+  /**
+   * @brief Computes the mapping coefficients from the in- and output mesh.
+   *
+   * If the mapping has been computed before and the revisions of both meshes did not
+   * change since, the matrices, the solver, and its preconditioner are reused.
+   */
   virtual void computeMapping() override;
 
   /// Returns true, if computeMapping() has been called.
   virtual bool hasComputedMapping() const override;
 
-  /// Removes a computed mapping.
+  /// Removes a computed mapping and frees its matrices and solvers.
   virtual void clear() override;
 
   /// Maps input data to output data from input mesh to output mesh.
   virtual void map(int inputDataID, int outputDataID) override;
 
   friend struct MappingTests::PetRadialBasisFunctionMapping::Serial::SolutionCaching;
+  friend struct MappingTests::PetRadialBasisFunctionMapping::Serial::ReuseUnchangedMeshes;
 
   virtual void tagMeshFirstRound() override;
 
   virtual void tagMeshSecondRound() override;
 
 private:
-  /// Stores col -> value for each row. Used to return the already computed values from the preconditioning
-  using VertexData = std::vector<std::vector<std::pair<int, double>>>;
+  /// Local rows of a matrix in compressed sparse row format, using global PETSc column indices
+  struct CSRRows {
+    std::vector<PetscInt>    offsets{0};
+    std::vector<PetscInt>    columns;
+    std::vector<PetscScalar> values;
+  };
 
   mutable logging::Logger _log{"mapping::PetRadialBasisFctMapping"};
 
   bool _hasComputedMapping = false;
 
+  /// True, if the matrices and solvers of the last computed mapping are kept for reuse
+  bool _hasOperators = false;
+
+  /// ID of the event of map(), registered by computeMapping()
+  int _mapDataEvent = -1;
+
   /// Radial basis function type used in interpolation.
   RADIAL_BASIS_FUNCTION_T _basisFunction;
 
   /// Interpolation system matrix. Evaluated basis function on the input mesh
   petsc::Matrix _matrixC;
 
+  /// Copy of matrix C in AIJ format to build preconditioners which do not support the symmetric format
+  petsc::Matrix _matrixP;
+
   /// Vandermonde Matrix for linear polynomial, constructed from vertices of the input mesh
   petsc::Matrix _matrixQ;
 
@@ -159,6 +187,22 @@ private:
   /// Toggles use of preallocation for matrix C and A
   const Preallocation _preallocation;
 
+  /// Amount of threads used to compute the entries of matrix C and A
+  const int _threads;
+
+  /// Solver and preconditioner used for matrix C
+  const SolverPreset _solverPreset;
+
+  /// Revisions of the input and output mesh of the kept matrices and solvers
+  std::uint64_t _inputRevision  = 0;
+  std::uint64_t _outputRevision = 0;
+
+  /// Destroys all PETSc objects of a computed mapping.
+  void release();
+
+  /// Applies the solver preset to the solver of matrix C and sets up its preconditioner.
+  void configureSolver();
+
   void estimatePreallocationMatrixC(int rows, int cols, mesh::PtrMesh mesh);
 
   void estimatePreallocationMatrixA(int rows, int cols, mesh::PtrMesh mesh);
@@ -172,14 +216,43 @@ private:
 
   void computePreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
 
-  VertexData savedPreallocationMatrixC(const mesh::PtrMesh inMesh);
+  /**
+   * @brief Collects the entries of all local rows on multiple threads.
+   *
+   * rowEntries(row, entries) appends the (column, value) pairs of a row to entries,
+   * which are sorted by column afterwards. It is called concurrently for different rows.
+   */
+  template <typename ROW_FUNCTION_T>
+  CSRRows collectRows(size_t rows, ROW_FUNCTION_T rowEntries) const;
 
-  VertexData savedPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
+  /// Calls function(i) for all input vertices i, which are candidates for the support of the given vertex.
+  /*
+   * Uses a boost::geometry spatial tree for the neighbor search, if given, otherwise all vertices are candidates.
+   * Safe to call concurrently.
+   */
+  template <typename FUNCTION_T>
+  void forEachCandidate(
+      const mesh::PtrMesh &                  inMesh,
+      const mesh::rtree::vertex_traits::Ptr &tree,
+      const mesh::Vertex &                   vertex,
+      FUNCTION_T                             function) const;
 
-  /// Preallocate matrix C and saves the coefficients using a boost::geometry spatial tree for neighbor search
-  VertexData bgPreallocationMatrixC(const mesh::PtrMesh inMesh);
+  /// Returns the distance of two vertices, ignoring dead axes.
+  double deadAxisDistance(const mesh::Vertex &a, const mesh::Vertex &b) const;
+
+  /**
+   * @brief Preallocates and fills matrix C with one call to PETSc.
+   *
+   * The coefficients of the local rows are computed on multiple threads and handed to PETSc in
+   * compressed sparse row format. The polynomial rows are preallocated densely, as the remaining
+   * ranks add their polynomial entries later on.
+   *
+   * @param[in] mappedColumns Column of every input vertex in the PETSc ordering
+   */
+  void fillMatrixCFromCSR(const mesh::PtrMesh inMesh, const std::vector<PetscInt> &mappedColumns);
 
-  VertexData bgPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
+  /// Preallocates and fills matrix A with one call to PETSc, including the integrated polynomial.
+  void fillMatrixAFromCSR(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh, const std::vector<PetscInt> &mappedColumns);
 };
 
 // --------------------------------------------------- HEADER IMPLEMENTATIONS
@@ -194,10 +267,13 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::PetRadialBasisFctMapping(
     bool                           zDead,
     double                         solverRtol,
     Polynomial                     polynomial,
-    Preallocation                  preallocation)
+    Preallocation                  preallocation,
+    int                            threads,
+    SolverPreset                   solverPreset)
     : Mapping(constraint, dimensions),
       _basisFunction(function),
       _matrixC("C"),
+      _matrixP("P"),
       _matrixQ("Q"),
       _matrixA("A"),
       _matrixV("V"),
@@ -206,7 +282,9 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::PetRadialBasisFctMapping(
       _AOmapping(nullptr),
       _solverRtol(solverRtol),
       _polynomial(polynomial),
-      _preallocation(preallocation)
+      _preallocation(preallocation),
+      _threads(utils::resolveThreadCount(threads)),
+      _solverPreset(solverPreset)
 {
   setInputRequirement(Mapping::MeshRequirement::VERTEX);
   setOutputRequirement(Mapping::MeshRequirement::VERTEX);
@@ -244,8 +322,17 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   PRECICE_TRACE();
   precice::utils::Event e("map.pet.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
   precice::utils::Event ePreCompute("map.pet.preComputeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  _mapDataEvent = getEventID("map.pet.mapData");
 
-  clear();
+  if (_hasOperators and _inputRevision == input()->getRevision() and _outputRevision == output()->getRevision()) {
+    PRECICE_DEBUG("Reusing matrices and preconditioner, as the meshes did not change.");
+    e.addData("Reused", 1);
+    _hasComputedMapping = true;
+    return;
+  }
+  release();
+  _inputRevision  = input()->getRevision();
+  _outputRevision = output()->getRevision();
 
   if (_polynomial == Polynomial::ON) {
     PRECICE_DEBUG("Using integrated polynomial.");
@@ -332,37 +419,44 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 
   Eigen::VectorXd distance(dimensions);
 
-  // We do preallocating of the matrices C and A. That means we traverse the input data once, just
-  // to know where we have entries in the sparse matrix. This information petsc can use to
-  // preallocate the matrix. In the second phase we actually fill the matrix.
-
-  // Stores col -> value for each row;
-  VertexData vertexData;
-
-  if (_preallocation == Preallocation::SAVE) {
-    vertexData = savedPreallocationMatrixC(inMesh);
+  // With saved or tree-based preallocation, the coefficients of C and A are computed on multiple
+  // threads and handed to PETSc in compressed sparse row format, which preallocates and fills the
+  // matrices at once. Otherwise, we do preallocating of the matrices C and A. That means we traverse
+  // the input data once, just to know where we have entries in the sparse matrix. This information
+  // petsc can use to preallocate the matrix. In the second phase we actually fill the matrix.
+  bool const useCSR = _preallocation == Preallocation::SAVE or _preallocation == Preallocation::TREE;
+
+  // Column of every input vertex in the PETSc ordering. The AO is applied once beforehand, as PETSc is not thread-safe.
+  std::vector<PetscInt> mappedColumns;
+  if (useCSR) {
+    mappedColumns.reserve(inMesh->vertices().size());
+    for (const mesh::Vertex &v : inMesh->vertices())
+      mappedColumns.push_back(v.getGlobalIndex() + polyparams);
+    ierr = AOApplicationToPetsc(_AOmapping, mappedColumns.size(), mappedColumns.data());
+    CHKERRV(ierr);
   }
+
   if (_preallocation == Preallocation::COMPUTE) {
     computePreallocationMatrixC(inMesh);
   }
   if (_preallocation == Preallocation::ESTIMATE) {
     estimatePreallocationMatrixC(n, n, inMesh);
   }
-  if (_preallocation == Preallocation::TREE) {
-    vertexData = bgPreallocationMatrixC(inMesh);
-  }
 
   // -- BEGIN FILL LOOP FOR MATRIX C --
   PRECICE_DEBUG("Begin filling matrix C");
   precice::utils::Event eFillC("map.pet.fillC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
+  if (useCSR) {
+    fillMatrixCFromCSR(inMesh, mappedColumns);
+  }
+
   // We collect entries for each row and set them blockwise using MatSetValues.
   PetscInt const           idxSize = std::max(_matrixC.getSize().second, _matrixQ.getSize().second);
   std::vector<PetscInt>    colIdx(idxSize);  // holds the columns indices of the entries
   std::vector<PetscScalar> rowVals(idxSize); // holds the values of the entries
 
-  int      preallocRow = 0;
-  PetscInt row         = _matrixC.ownerRange().first + localPolyparams;
+  PetscInt row = _matrixC.ownerRange().first + localPolyparams;
   for (const mesh::Vertex &inVertex : inMesh->vertices()) {
     if (not inVertex.isOwner())
       continue;
@@ -393,30 +487,25 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     }
 
     // -- SETS THE COEFFICIENTS --
-    if (_preallocation == Preallocation::SAVE or _preallocation == Preallocation::TREE) {
-      auto const &rowVertices = vertexData[preallocRow];
-      for (const auto &vertex : rowVertices) {
-        rowVals[colNum]  = _basisFunction.evaluate(vertex.second);
-        colIdx[colNum++] = vertex.first;
-      }
-      ++preallocRow;
-    } else {
-      for (const mesh::Vertex &vj : inMesh->vertices()) {
-        int const col = vj.getGlobalIndex() + polyparams;
-        if (row > col)
-          continue; // matrix is symmetric
-        distance = inVertex.getCoords() - vj.getCoords();
-        for (int d = 0; d < dimensions; d++) {
-          if (_deadAxis[d]) {
-            distance[d] = 0;
-          }
-        }
-        double const norm = distance.norm();
-        if (_basisFunction.getSupportRadius() > norm) {
-          rowVals[colNum]  = _basisFunction.evaluate(norm);
-          colIdx[colNum++] = col; // column of entry is the globalIndex
+    if (useCSR) {
+      ++row;
+      continue;
+    }
+    for (const mesh::Vertex &vj : inMesh->vertices()) {
+      int const col = vj.getGlobalIndex() + polyparams;
+      if (row > col)
+        continue; // matrix is symmetric
+      distance = inVertex.getCoords() - vj.getCoords();
+      for (int d = 0; d < dimensions; d++) {
+        if (_deadAxis[d]) {
+          distance[d] = 0;
         }
       }
+      double const norm = distance.norm();
+      if (_basisFunction.getSupportRadius() > norm) {
+        rowVals[colNum]  = _basisFunction.evaluate(norm);
+        colIdx[colNum++] = col; // column of entry is the globalIndex
+      }
     }
     ierr = AOApplicationToPetsc(_AOmapping, colNum, colIdx.data());
     CHKERRV(ierr);
@@ -439,18 +528,12 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   ierr = MatAssemblyBegin(_matrixQ, MAT_FINAL_ASSEMBLY);
   CHKERRV(ierr);
 
-  if (_preallocation == Preallocation::SAVE) {
-    vertexData = savedPreallocationMatrixA(inMesh, outMesh);
-  }
   if (_preallocation == Preallocation::COMPUTE) {
     computePreallocationMatrixA(inMesh, outMesh);
   }
   if (_preallocation == Preallocation::ESTIMATE) {
     estimatePreallocationMatrixA(outputSize, n, inMesh);
   }
-  if (_preallocation == Preallocation::TREE) {
-    vertexData = bgPreallocationMatrixA(inMesh, outMesh);
-  }
 
   // holds the columns indices of the entries
   colIdx.resize(std::max(_matrixA.getSize().second, _matrixV.getSize().second));
@@ -461,11 +544,16 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   PRECICE_DEBUG("Begin filling matrix A.");
   precice::utils::Event eFillA("map.pet.fillA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
+  if (useCSR) {
+    fillMatrixAFromCSR(inMesh, outMesh, mappedColumns);
+  }
+
   for (PetscInt row = ownerRangeABegin; row < ownerRangeAEnd; ++row) {
     mesh::Vertex const &oVertex = outMesh->vertices()[row - _matrixA.ownerRange().first];
 
     // -- SET THE POLYNOMIAL PART OF THE MATRIX --
-    if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
+    // The integrated polynomial is already part of the compressed rows of A
+    if (_polynomial == Polynomial::SEPARATE or (_polynomial == Polynomial::ON and not useCSR)) {
       petsc::Matrix *m      = _polynomial == Polynomial::ON ? &_matrixA : &_matrixV;
       PetscInt       colNum = 0;
 
@@ -483,26 +571,20 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     }
 
     // -- SETS THE COEFFICIENTS --
-    PetscInt colNum = 0;
+    if (useCSR)
+      continue;
 
-    if (_preallocation == Preallocation::SAVE or _preallocation == Preallocation::TREE) {
-      auto const &rowVertices = vertexData[row - ownerRangeABegin];
-      for (const auto &vertex : rowVertices) {
-        rowVals[colNum]  = _basisFunction.evaluate(vertex.second);
-        colIdx[colNum++] = vertex.first;
+    PetscInt colNum = 0;
+    for (const mesh::Vertex &inVertex : inMesh->vertices()) {
+      distance = oVertex.getCoords() - inVertex.getCoords();
+      for (int d = 0; d < dimensions; d++) {
+        if (_deadAxis[d])
+          distance[d] = 0;
       }
-    } else {
-      for (const mesh::Vertex &inVertex : inMesh->vertices()) {
-        distance = oVertex.getCoords() - inVertex.getCoords();
-        for (int d = 0; d < dimensions; d++) {
-          if (_deadAxis[d])
-            distance[d] = 0;
-        }
-        double const norm = distance.norm();
-        if (_basisFunction.getSupportRadius() > norm) {
-          rowVals[colNum]  = _basisFunction.evaluate(norm);
-          colIdx[colNum++] = inVertex.getGlobalIndex() + polyparams;
-        }
+      double const norm = distance.norm();
+      if (_basisFunction.getSupportRadius() > norm) {
+        rowVals[colNum]  = _basisFunction.evaluate(norm);
+        colIdx[colNum++] = inVertex.getGlobalIndex() + polyparams;
       }
     }
     ierr = AOApplicationToPetsc(_AOmapping, colNum, colIdx.data());
@@ -541,25 +623,10 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     KSPSetOperators(_QRsolver, _matrixQ, _matrixQ);
   }
 
-  // -- CONFIGURE SOLVER FOR SYSTEM MATRIX --
-  KSPSetOperators(_solver, _matrixC, _matrixC);
-  CHKERRV(ierr);
-  KSPSetTolerances(_solver, _solverRtol, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT);
-  KSPSetInitialGuessNonzero(_solver, PETSC_TRUE);
-  CHKERRV(ierr);                            // Reuse the results from the last iteration, held in the out vector.
-  KSPSetOptionsPrefix(_solver, "solverC_"); // s.t. options for only this solver can be set on the command line
-  KSPSetFromOptions(_solver);
-
   eSolverInit.stop();
 
-  // if (totalNNZ > static_cast<size_t>(20*n)) {
-  //   PRECICE_DEBUG("Using Cholesky decomposition as direct solver for dense matrix.");
-  //   PC prec;
-  //   KSPSetType(_solver, KSPPREONLY);
-  //   KSPGetPC(_solver, &prec);
-  //   PCSetType(prec, PCCHOLESKY);
-  //   PCFactorSetShiftType(prec, MAT_SHIFT_NONZERO);
-  // }
+  // -- CONFIGURE SOLVER FOR SYSTEM MATRIX --
+  configureSolver();
 
   // -- COMPUTE RESCALING COEFFICIENTS USING THE SYSTEM MATRIX C SOLVER --
   if (useRescaling and (_polynomial == Polynomial::SEPARATE)) {
@@ -583,6 +650,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   }
 
   _hasComputedMapping = true;
+  _hasOperators       = true;
 
   PRECICE_DEBUG("Number of mallocs for matrix C = " << _matrixC.getInfo(MAT_LOCAL).mallocs);
   PRECICE_DEBUG("Non-zeros allocated / used / unused for matrix C = " << _matrixC.getInfo(MAT_LOCAL).nz_allocated << " / " << _matrixC.getInfo(MAT_LOCAL).nz_used << " / " << _matrixC.getInfo(MAT_LOCAL).nz_unneeded);
@@ -598,8 +666,16 @@ bool PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::hasComputedMapping() con
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  // The matrices and solvers are kept, computeMapping() reuses them if the meshes did not change.
+  _hasComputedMapping = false;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::release()
 {
   _matrixC.reset();
+  _matrixP.reset();
   _matrixA.reset();
   _matrixQ.reset();
   _matrixV.reset();
@@ -611,13 +687,99 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
 
   previousSolution.clear();
   _hasComputedMapping = false;
+  _hasOperators       = false;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::configureSolver()
+{
+  PRECICE_TRACE();
+  precice::utils::Event eSetup("map.pet.setupSolver.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  PetscErrorCode ierr = 0;
+  PC             pc;
+  ierr = KSPGetPC(_solver, &pc);
+  CHKERRV(ierr);
+
+  if (_solverPreset == SolverPreset::CG_GAMG) {
+    // GAMG does not support the symmetric block format of C
+    ierr = MatDestroy(&_matrixP.matrix);
+    CHKERRV(ierr);
+    ierr = MatConvert(_matrixC, MATAIJ, MAT_INITIAL_MATRIX, &_matrixP.matrix);
+    CHKERRV(ierr);
+    ierr = KSPSetOperators(_solver, _matrixC, _matrixP);
+  } else {
+    ierr = KSPSetOperators(_solver, _matrixC, _matrixC);
+  }
+  CHKERRV(ierr);
+
+  if (_solverPreset == SolverPreset::CG_BJACOBI_ICC) {
+    PRECICE_DEBUG("Using CG, preconditioned by block Jacobi with incomplete Cholesky.");
+    KSPSetType(_solver, KSPCG);
+    PCSetType(pc, PCBJACOBI);
+  } else if (_solverPreset == SolverPreset::CG_GAMG) {
+    PRECICE_DEBUG("Using CG, preconditioned by algebraic multigrid.");
+    KSPSetType(_solver, KSPCG);
+    PCSetType(pc, PCGAMG);
+  } else if (_solverPreset == SolverPreset::CHOLESKY) {
+    PRECICE_DEBUG("Using Cholesky decomposition as direct solver.");
+    KSPSetType(_solver, KSPPREONLY);
+    PCSetType(pc, PCCHOLESKY);
+#ifdef PETSC_HAVE_MUMPS
+#if PETSC_VERSION_GE(3, 9, 0)
+    PCFactorSetMatSolverType(pc, MATSOLVERMUMPS);
+#else
+    PCFactorSetMatSolverPackage(pc, MATSOLVERMUMPS);
+#endif
+#else
+    PRECICE_CHECK(utils::Parallel::getCommunicatorSize() == 1,
+                  "The Cholesky solver of RBF mappings requires PETSc with MUMPS in parallel.");
+#endif
+    PCFactorSetShiftType(pc, MAT_SHIFT_NONZERO);
+  }
+
+  KSPSetTolerances(_solver, _solverRtol, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT);
+  if (_solverPreset != SolverPreset::CHOLESKY) {
+    KSPSetInitialGuessNonzero(_solver, PETSC_TRUE); // Reuse the results from the last iteration, held in the out vector.
+  }
+  KSPSetOptionsPrefix(_solver, "solverC_"); // s.t. options for only this solver can be set on the command line
+  KSPSetFromOptions(_solver);
+
+  // The operators only change after a change of the meshes, which sets up a new solver
+  KSPSetReusePreconditioner(_solver, PETSC_TRUE);
+  ierr = KSPSetUp(_solver);
+  CHKERRV(ierr);
+
+  if (_solverPreset == SolverPreset::CG_BJACOBI_ICC) {
+    // The blocks only exist after the setup of the outer preconditioner
+    KSP *    subKSPs;
+    PetscInt localBlocks, firstBlock;
+    ierr = PCBJacobiGetSubKSP(pc, &localBlocks, &firstBlock, &subKSPs);
+    CHKERRV(ierr);
+    for (PetscInt i = 0; i < localBlocks; i++) {
+      PC subPC;
+      KSPSetType(subKSPs[i], KSPPREONLY);
+      KSPGetPC(subKSPs[i], &subPC);
+      PCSetType(subPC, PCICC);
+      KSPSetFromOptions(subKSPs[i]);
+    }
+  }
+  // Factorizes the blocks of block Jacobi now, which would be deferred to the first solve otherwise
+  ierr = KSPSetUpOnBlocks(_solver);
+  CHKERRV(ierr);
+
+  KSPType kspType;
+  PCType  pcType;
+  KSPGetType(_solver, &kspType);
+  PCGetType(pc, &pcType);
+  PRECICE_INFO("Solving the RBF system using " << kspType << " with " << pcType << " as preconditioner");
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int outputDataID)
 {
   PRECICE_TRACE(inputDataID, outputDataID);
-  precice::utils::Event e("map.pet.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
 
   PRECICE_ASSERT(_hasComputedMapping);
   PRECICE_ASSERT(input()->getDimensions() == output()->getDimensions(),
@@ -636,16 +798,27 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
     auto in = petsc::Vector::allocate(_matrixA, "in");
     int  inRangeStart, inRangeEnd;
     std::tie(inRangeStart, inRangeEnd) = in.ownerRange();
+
+    // The local rows and their positions in the input data are the same for all components
+    std::vector<PetscInt> inIdx, inPos;
+    for (size_t i = 0; i < input()->vertices().size(); i++) {
+      auto const globalIndex = input()->vertices()[i].getGlobalIndex(); // globalIndex is target row
+      if (globalIndex >= inRangeStart and globalIndex < inRangeEnd) {   // only fill local rows
+        inIdx.push_back(globalIndex);
+        inPos.push_back(i);
+      }
+    }
+    std::vector<PetscScalar> inVals(inIdx.size());
+
     for (int dim = 0; dim < valueDim; dim++) {
       printMappingInfo(inputDataID, dim);
 
       // Fill input from input data values
-      for (size_t i = 0; i < input()->vertices().size(); i++) {
-        auto const globalIndex = input()->vertices()[i].getGlobalIndex(); // globalIndex is target row
-        if (globalIndex >= inRangeStart and globalIndex < inRangeEnd)     // only fill local rows
-          ierr = VecSetValue(in, globalIndex, inValues[i * valueDim + dim], INSERT_VALUES);
-        CHKERRV(ierr);
+      for (size_t i = 0; i < inPos.size(); i++) {
+        inVals[i] = inValues[inPos[i] * valueDim + dim];
       }
+      ierr = VecSetValues(in, inIdx.size(), inIdx.data(), inVals.data(), INSERT_VALUES);
+      CHKERRV(ierr);
       in.assemble();
 
       // Gets the petsc::vector for the given combination of outputData, inputData and dimension
@@ -663,8 +836,11 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
         auto eta = petsc::Vector::allocate(_matrixA, "eta", petsc::Vector::RIGHT);
         ierr     = MatMultTranspose(_matrixA, in, eta);
         CHKERRV(ierr);
-        auto mu = petsc::Vector::allocate(_matrixC, "mu", petsc::Vector::LEFT);
+        auto         mu = petsc::Vector::allocate(_matrixC, "mu", petsc::Vector::LEFT);
+        utils::Event eSolve("map.pet.solveConservative.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
         _solver.solve(eta, mu);
+        eSolve.addData("Iterations", _solver.getIterationNumber());
+        eSolve.stop();
         VecScale(epsilon, -1);
         auto tau = petsc::Vector::allocate(_matrixQ, "tau", petsc::Vector::RIGHT);
         ierr     = MatMultTransposeAdd(_matrixQ, mu, epsilon, tau);
@@ -711,20 +887,25 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
 
     PetscScalar const *vecArray;
 
+    // The owned vertices and their rows are the same for all components
+    std::vector<PetscInt> inIdx, inPos;
+    inIdx.reserve(input()->vertices().size());
+    inPos.reserve(input()->vertices().size());
+    for (size_t i = 0; i < input()->vertices().size(); ++i) {
+      if (not input()->vertices()[i].isOwner())
+        continue;
+      inIdx.emplace_back(inIdx.size() + in.ownerRange().first + localPolyparams);
+      inPos.emplace_back(i);
+    }
+    std::vector<PetscScalar> inVals(inIdx.size());
+
     // For every data dimension, perform mapping
     for (int dim = 0; dim < valueDim; dim++) {
       printMappingInfo(inputDataID, dim);
 
       // Fill input from input data values
-      std::vector<PetscScalar> inVals;
-      inVals.reserve(input()->vertices().size());
-      std::vector<PetscInt> inIdx;
-      inIdx.reserve(input()->vertices().size());
-      for (size_t i = 0; i < input()->vertices().size(); ++i) {
-        if (not input()->vertices()[i].isOwner())
-          continue;
-        inVals.emplace_back(inValues[i * valueDim + dim]);
-        inIdx.emplace_back(inIdx.size() + in.ownerRange().first + localPolyparams);
+      for (size_t i = 0; i < inPos.size(); ++i) {
+        inVals[i] = inValues[inPos[i] * valueDim + dim];
       }
       ierr = VecSetValues(in, inIdx.size(), inIdx.data(), inVals.data(), INSERT_VALUES);
       CHKERRV(ierr);
@@ -1131,341 +1312,188 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computePreallocationMatr
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
-PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixC(mesh::PtrMesh const inMesh)
+template <typename ROW_FUNCTION_T>
+typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::CSRRows
+PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::collectRows(size_t rows, ROW_FUNCTION_T rowEntries) const
 {
-  precice::utils::Event ePreallocC("map.pet.preallocC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
-
-  PetscInt n;
-
-  int             dimensions = input()->getDimensions();
-  Eigen::VectorXd distance(dimensions);
-
-  std::tie(n, std::ignore) = _matrixC.getLocalSize();
-  std::vector<PetscInt> d_nnz(n), o_nnz(n);
-  PetscInt              colOwnerRangeCBegin, colOwnerRangeCEnd;
-  std::tie(colOwnerRangeCBegin, colOwnerRangeCEnd) = _matrixC.ownerRangeColumn();
-
-  VertexData vertexData(n - localPolyparams);
-
-  size_t local_row = 0;
-  // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
-  if (_polynomial == Polynomial::ON) {
-    for (local_row = 0; local_row < localPolyparams; local_row++) {
-      d_nnz[local_row] = colOwnerRangeCEnd - colOwnerRangeCBegin;
-      o_nnz[local_row] = _matrixC.getSize().first - d_nnz[local_row];
-    }
-  }
-
-  for (const mesh::Vertex &inVertex : inMesh->vertices()) {
-    if (not inVertex.isOwner())
-      continue;
-
-    PetscInt  col        = polyparams - 1;
-    const int global_row = local_row + _matrixC.ownerRange().first;
-    d_nnz[local_row]     = 0;
-    o_nnz[local_row]     = 0;
-
-    // -- PREALLOCATES THE COEFFICIENTS --
-    for (mesh::Vertex &vj : inMesh->vertices()) {
-      col++;
-
-      PetscInt mappedCol = vj.getGlobalIndex() + polyparams;
-      AOApplicationToPetsc(_AOmapping, 1, &mappedCol); // likely not efficient in the inner loop
-
-      if (global_row > mappedCol) // Skip, since we are below the diagonal
-        continue;
-
-      distance = inVertex.getCoords() - vj.getCoords();
-      for (int d = 0; d < dimensions; d++)
-        if (_deadAxis[d])
-          distance[d] = 0;
-
-      double const norm = distance.norm();
-      if (_basisFunction.getSupportRadius() > norm or col == global_row) {
-        vertexData[local_row - localPolyparams].emplace_back(vj.getGlobalIndex() + polyparams, norm);
-        if (mappedCol >= colOwnerRangeCBegin and mappedCol < colOwnerRangeCEnd)
-          d_nnz[local_row]++;
-        else
-          o_nnz[local_row]++;
+  using Entry = std::pair<PetscInt, PetscScalar>;
+
+  // Every thread collects a contiguous block of rows, which are concatenated afterwards
+  std::vector<std::pair<size_t, CSRRows>> blocks;
+  std::mutex                              blocksMutex;
+  utils::parallelFor(rows, _threads, [&](size_t begin, size_t end) {
+    CSRRows            block;
+    std::vector<Entry> entries;
+    block.offsets.reserve(end - begin + 1);
+    for (size_t row = begin; row < end; row++) {
+      entries.clear();
+      rowEntries(row, entries);
+      std::sort(entries.begin(), entries.end(), [](Entry const &a, Entry const &b) { return a.first < b.first; });
+      for (Entry const &entry : entries) {
+        block.columns.push_back(entry.first);
+        block.values.push_back(entry.second);
       }
+      block.offsets.push_back(block.columns.size());
     }
-    local_row++;
+    std::lock_guard<std::mutex> lock(blocksMutex);
+    blocks.emplace_back(begin, std::move(block));
+  });
+  std::sort(blocks.begin(), blocks.end(), [](std::pair<size_t, CSRRows> const &a, std::pair<size_t, CSRRows> const &b) {
+    return a.first < b.first;
+  });
+
+  CSRRows csr;
+  size_t  entries = 0;
+  for (auto const &block : blocks)
+    entries += block.second.columns.size();
+  csr.offsets.reserve(rows + 1);
+  csr.columns.reserve(entries);
+  csr.values.reserve(entries);
+  for (auto const &block : blocks) {
+    PetscInt const offset = csr.columns.size();
+    for (size_t i = 1; i < block.second.offsets.size(); i++)
+      csr.offsets.push_back(offset + block.second.offsets[i]);
+    csr.columns.insert(csr.columns.end(), block.second.columns.begin(), block.second.columns.end());
+    csr.values.insert(csr.values.end(), block.second.values.begin(), block.second.values.end());
   }
+  return csr;
+}
 
-  if (utils::Parallel::getCommunicatorSize() == 1) {
-    // std::cout << "Computed Preallocation C Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << '\n';
-    MatSeqSBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data());
-  } else {
-    // std::cout << "Computed Preallocation C MPI diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0)
-    //           << ", off-diagonal = " << std::accumulate(o_nnz.begin(), o_nnz.end(), 0) << '\n';
-    MatMPISBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data(), 0, o_nnz.data());
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::forEachCandidate(
+    const mesh::PtrMesh &                  inMesh,
+    const mesh::rtree::vertex_traits::Ptr &tree,
+    const mesh::Vertex &                   vertex,
+    FUNCTION_T                             function) const
+{
+  namespace bg = boost::geometry;
+  if (not tree) {
+    for (size_t i = 0; i < inMesh->vertices().size(); i++)
+      function(i);
+    return;
   }
-  MatSetOption(_matrixC, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
 
-  ePreallocC.stop();
-
-  return vertexData;
+  double const supportRadius = _basisFunction.getSupportRadius();
+  auto         search_box    = mesh::getEnclosingBox(vertex, supportRadius);
+  tree->query(bg::index::within(search_box) and bg::index::satisfies([&](size_t const i) { return bg::distance(vertex, inMesh->vertices()[i]) <= supportRadius; }),
+              boost::make_function_output_iterator(function));
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
-PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(mesh::PtrMesh const inMesh, mesh::PtrMesh const outMesh)
+double PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::deadAxisDistance(const mesh::Vertex &a, const mesh::Vertex &b) const
 {
-  PRECICE_INFO("Using saved preallocation");
-  precice::utils::Event ePreallocA("map.pet.preallocA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
-
-  PetscInt ownerRangeABegin, ownerRangeAEnd, colOwnerRangeABegin, colOwnerRangeAEnd;
-  PetscInt outputSize;
-
-  std::tie(outputSize, std::ignore)                = _matrixA.getLocalSize(); // n hier nehmen
-  std::tie(ownerRangeABegin, ownerRangeAEnd)       = _matrixA.ownerRange();
-  std::tie(colOwnerRangeABegin, colOwnerRangeAEnd) = _matrixA.ownerRangeColumn();
-  int dimensions                                   = input()->getDimensions();
-
-  std::vector<PetscInt> d_nnz(outputSize), o_nnz(outputSize);
-  Eigen::VectorXd       distance(dimensions);
-
-  // Contains localRow<localCols<colPosition, distance>>>
-  VertexData vertexData(outputSize);
-
-  for (int localRow = 0; localRow < ownerRangeAEnd - ownerRangeABegin; localRow++) {
-    d_nnz[localRow]             = 0;
-    o_nnz[localRow]             = 0;
-    PetscInt            col     = 0;
-    const mesh::Vertex &oVertex = outMesh->vertices()[localRow];
-
-    // -- PREALLOCATE THE POLYNOM PART OF THE MATRIX --
-    // col does not need mapping here, because the first polyparams col are always identity mapped
-    if (_polynomial == Polynomial::ON) {
-      if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-        d_nnz[localRow]++;
-      else
-        o_nnz[localRow]++;
-      col++;
-
-      for (int dim = 0; dim < dimensions; dim++) {
-        if (not _deadAxis[dim]) {
-          if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-            d_nnz[localRow]++;
-          else
-            o_nnz[localRow]++;
-          col++;
-        }
-      }
-    }
-
-    // -- PREALLOCATE THE COEFFICIENTS --
-    for (const mesh::Vertex &inVertex : inMesh->vertices()) {
-      distance = oVertex.getCoords() - inVertex.getCoords();
-      for (int d = 0; d < dimensions; d++)
-        if (_deadAxis[d])
-          distance[d] = 0;
-
-      double const norm = distance.norm();
-      if (_basisFunction.getSupportRadius() > norm) {
-        col = inVertex.getGlobalIndex() + polyparams;
-        vertexData[localRow].emplace_back(col, norm);
-
-        AOApplicationToPetsc(_AOmapping, 1, &col);
-        if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-          d_nnz[localRow]++;
-        else
-          o_nnz[localRow]++;
-      }
-    }
-  }
-  if (utils::Parallel::getCommunicatorSize() == 1) {
-    // std::cout << "Preallocation A Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << '\n';
-    MatSeqAIJSetPreallocation(_matrixA, 0, d_nnz.data());
-  } else {
-    // std::cout << "Preallocation A MPI diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0)
-    //           << ", off-diagonal = " << std::accumulate(o_nnz.begin(), o_nnz.end(), 0) << '\n';
-    MatMPIAIJSetPreallocation(_matrixA, 0, d_nnz.data(), 0, o_nnz.data());
+  double squaredNorm = 0;
+  for (int d = 0; d < a.getDimensions(); d++) {
+    if (not _deadAxis[d])
+      squaredNorm += std::pow(a.getCoords()[d] - b.getCoords()[d], 2);
   }
-  MatSetOption(_matrixA, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-
-  ePreallocA.stop();
-  return vertexData;
+  return std::sqrt(squaredNorm);
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
-PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixC(mesh::PtrMesh const inMesh)
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::fillMatrixCFromCSR(mesh::PtrMesh const inMesh, std::vector<PetscInt> const &mappedColumns)
 {
-  PRECICE_INFO("Using tree-based preallocation for matrix C");
+  PRECICE_INFO("Using " << (_preallocation == Preallocation::TREE ? "tree-based" : "saved") << " preallocation for matrix C on " << _threads << " threads");
   precice::utils::Event ePreallocC("map.pet.preallocC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
-  namespace bg = boost::geometry;
-
-  PetscInt n;
-  std::tie(n, std::ignore) = _matrixC.getLocalSize();
-  std::vector<PetscInt> d_nnz(n), o_nnz(n);
 
-  auto tree = mesh::rtree::getVertexRTree(inMesh);
+  mesh::rtree::vertex_traits::Ptr tree;
+  if (_preallocation == Preallocation::TREE)
+    tree = mesh::rtree::getVertexRTree(inMesh, _threads);
 
-  double const supportRadius = _basisFunction.getSupportRadius();
-
-  int             dimensions = input()->getDimensions();
-  Eigen::VectorXd distance(dimensions);
-
-  PetscInt colOwnerRangeCBegin, colOwnerRangeCEnd;
-  std::tie(colOwnerRangeCBegin, colOwnerRangeCEnd) = _matrixC.ownerRangeColumn();
-
-  VertexData vertexData(n - localPolyparams);
-
-  size_t local_row = 0;
-  // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
-  if (_polynomial == Polynomial::ON) {
-    for (local_row = 0; local_row < localPolyparams; local_row++) {
-      d_nnz[local_row] = colOwnerRangeCEnd - colOwnerRangeCBegin;
-      o_nnz[local_row] = _matrixC.getSize().first - d_nnz[local_row];
-    }
+  // Owned vertices in the order of the local rows
+  std::vector<size_t> rowVertices;
+  for (size_t i = 0; i < inMesh->vertices().size(); i++) {
+    if (inMesh->vertices()[i].isOwner())
+      rowVertices.push_back(i);
   }
 
-  std::vector<size_t> results;
-  for (const mesh::Vertex &inVertex : inMesh->vertices()) {
-    if (not inVertex.isOwner())
-      continue;
-
-    PetscInt       col        = polyparams;
-    PetscInt const global_row = local_row + _matrixC.ownerRange().first;
-    d_nnz[local_row]          = 0;
-    o_nnz[local_row]          = 0;
-    results.clear();
-
-    // -- PREALLOCATES THE COEFFICIENTS --
-    auto search_box = mesh::getEnclosingBox(inVertex, supportRadius);
-
-    tree->query(bg::index::within(search_box) and bg::index::satisfies([&](size_t const i) { return bg::distance(inVertex, inMesh->vertices()[i]) <= supportRadius; }),
-                std::back_inserter(results));
-
-    // for (mesh::Vertex& vj : inMesh->vertices()) {
-    for (auto const i : results) {
-      const mesh::Vertex &vj = inMesh->vertices()[i];
-
-      PetscInt mappedCol = vj.getGlobalIndex() + polyparams;
-      AOApplicationToPetsc(_AOmapping, 1, &mappedCol); // likely not efficient in the inner loop
-
-      if (global_row > mappedCol) // Skip, since we are below the diagonal
-        continue;
-
-      distance = inVertex.getCoords() - vj.getCoords();
-      for (int d = 0; d < dimensions; d++)
-        if (_deadAxis[d])
-          distance[d] = 0;
-
-      double const norm = distance.norm();
-      if (supportRadius > norm or col == global_row) {
-        vertexData[local_row - localPolyparams].emplace_back(vj.getGlobalIndex() + polyparams, norm);
-        if (mappedCol >= colOwnerRangeCBegin and mappedCol < colOwnerRangeCEnd)
-          d_nnz[local_row]++;
-        else
-          o_nnz[local_row]++;
-      }
-      col++;
+  double const   supportRadius = _basisFunction.getSupportRadius();
+  PetscInt const firstRow      = _matrixC.ownerRange().first;
+  PetscInt const globalSize    = _matrixC.getSize().second;
+
+  // Only the upper triangular part is stored, as the matrix is symmetric
+  CSRRows csr = collectRows(localPolyparams + rowVertices.size(), [&](size_t localRow, std::vector<std::pair<PetscInt, PetscScalar>> &entries) {
+    PetscInt const globalRow = firstRow + localRow;
+
+    // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
+    if (localRow < localPolyparams) {
+      for (PetscInt col = globalRow; col < globalSize; col++)
+        entries.emplace_back(col, 0.0);
+      return;
     }
-    local_row++;
-  }
 
+    // -- SETS THE COEFFICIENTS --
+    mesh::Vertex const &inVertex = inMesh->vertices()[rowVertices[localRow - localPolyparams]];
+    forEachCandidate(inMesh, tree, inVertex, [&](size_t const i) {
+      PetscInt const col = mappedColumns[i];
+      if (globalRow > col) // Skip, since we are below the diagonal
+        return;
+      double const norm = deadAxisDistance(inVertex, inMesh->vertices()[i]);
+      if (supportRadius > norm or col == globalRow)
+        entries.emplace_back(col, _basisFunction.evaluate(norm));
+    });
+  });
+
+  PetscErrorCode ierr = 0;
   if (utils::Parallel::getCommunicatorSize() == 1) {
-    MatSeqSBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data());
+    ierr = MatSeqSBAIJSetPreallocationCSR(_matrixC, _matrixC.blockSize(), csr.offsets.data(), csr.columns.data(), csr.values.data());
   } else {
-    MatMPISBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data(), 0, o_nnz.data());
+    ierr = MatMPISBAIJSetPreallocationCSR(_matrixC, _matrixC.blockSize(), csr.offsets.data(), csr.columns.data(), csr.values.data());
   }
+  CHKERRV(ierr);
   MatSetOption(_matrixC, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
 
+  ePreallocC.addData("NonZeros", static_cast<int>(csr.columns.size()));
   ePreallocC.stop();
-
-  return vertexData;
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
-PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixA(mesh::PtrMesh const inMesh, mesh::PtrMesh const outMesh)
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::fillMatrixAFromCSR(mesh::PtrMesh const inMesh, mesh::PtrMesh const outMesh, std::vector<PetscInt> const &mappedColumns)
 {
-  PRECICE_INFO("Using tree-based preallocation for matrix A");
+  PRECICE_INFO("Using " << (_preallocation == Preallocation::TREE ? "tree-based" : "saved") << " preallocation for matrix A on " << _threads << " threads");
   precice::utils::Event ePreallocA("map.pet.preallocA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
-  namespace bg = boost::geometry;
-
-  PetscInt       ownerRangeABegin, ownerRangeAEnd, colOwnerRangeABegin, colOwnerRangeAEnd;
-  PetscInt const outputSize    = _matrixA.getLocalSize().first;
-  auto           tree          = mesh::rtree::getVertexRTree(inMesh);
-  double const   supportRadius = _basisFunction.getSupportRadius();
-
-  std::tie(ownerRangeABegin, ownerRangeAEnd)       = _matrixA.ownerRange();
-  std::tie(colOwnerRangeABegin, colOwnerRangeAEnd) = _matrixA.ownerRangeColumn();
-  int dimensions                                   = input()->getDimensions();
 
-  std::vector<PetscInt> d_nnz(outputSize), o_nnz(outputSize);
-  Eigen::VectorXd       distance(dimensions);
+  mesh::rtree::vertex_traits::Ptr tree;
+  if (_preallocation == Preallocation::TREE)
+    tree = mesh::rtree::getVertexRTree(inMesh, _threads);
 
-  // Contains localRow<localCols<colPosition, distance>>>
-  VertexData          vertexData(outputSize);
-  std::vector<size_t> results;
+  double const supportRadius = _basisFunction.getSupportRadius();
+  int const    dimensions    = input()->getDimensions();
 
-  for (int localRow = 0; localRow < ownerRangeAEnd - ownerRangeABegin; ++localRow) {
-    d_nnz[localRow]             = 0;
-    o_nnz[localRow]             = 0;
-    PetscInt            col     = 0;
+  CSRRows csr = collectRows(_matrixA.getLocalSize().first, [&](size_t localRow, std::vector<std::pair<PetscInt, PetscScalar>> &entries) {
     mesh::Vertex const &oVertex = outMesh->vertices()[localRow];
 
-    // -- PREALLOCATE THE POLYNOM PART OF THE MATRIX --
+    // -- SETS THE POLYNOMIAL PART OF THE MATRIX --
     // col does not need mapping here, because the first polyparams col are always identity mapped
     if (_polynomial == Polynomial::ON) {
-      if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-        d_nnz[localRow]++;
-      else
-        o_nnz[localRow]++;
-      col++;
-
+      PetscInt col = 0;
+      entries.emplace_back(col++, 1.0);
       for (int dim = 0; dim < dimensions; dim++) {
-        if (not _deadAxis[dim]) {
-          if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-            d_nnz[localRow]++;
-          else
-            o_nnz[localRow]++;
-          col++;
-        }
+        if (not _deadAxis[dim])
+          entries.emplace_back(col++, oVertex.getCoords()[dim]);
       }
     }
 
-    // -- PREALLOCATE THE COEFFICIENTS --
-    results.clear();
-    auto search_box = mesh::getEnclosingBox(oVertex, supportRadius);
-
-    tree->query(bg::index::within(search_box) and bg::index::satisfies([&](size_t const i) { return bg::distance(oVertex, inMesh->vertices()[i]) <= supportRadius; }),
-                std::back_inserter(results));
-
-    for (auto i : results) {
-      const mesh::Vertex &inVertex = inMesh->vertices()[i];
-      distance                     = oVertex.getCoords() - inVertex.getCoords();
-
-      for (int d = 0; d < dimensions; d++)
-        if (_deadAxis[d])
-          distance[d] = 0;
-
-      double const norm = distance.norm();
-      if (supportRadius > norm) {
-        col = inVertex.getGlobalIndex() + polyparams;
-        vertexData[localRow].emplace_back(col, norm);
+    // -- SETS THE COEFFICIENTS --
+    forEachCandidate(inMesh, tree, oVertex, [&](size_t const i) {
+      double const norm = deadAxisDistance(oVertex, inMesh->vertices()[i]);
+      if (supportRadius > norm)
+        entries.emplace_back(mappedColumns[i], _basisFunction.evaluate(norm));
+    });
+  });
 
-        AOApplicationToPetsc(_AOmapping, 1, &col);
-        if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-          d_nnz[localRow]++;
-        else
-          o_nnz[localRow]++;
-      }
-    }
-  }
+  PetscErrorCode ierr = 0;
   if (utils::Parallel::getCommunicatorSize() == 1) {
-    MatSeqAIJSetPreallocation(_matrixA, 0, d_nnz.data());
+    ierr = MatSeqAIJSetPreallocationCSR(_matrixA, csr.offsets.data(), csr.columns.data(), csr.values.data());
   } else {
-    MatMPIAIJSetPreallocation(_matrixA, 0, d_nnz.data(), 0, o_nnz.data());
+    ierr = MatMPIAIJSetPreallocationCSR(_matrixA, csr.offsets.data(), csr.columns.data(), csr.values.data());
   }
+  CHKERRV(ierr);
   MatSetOption(_matrixA, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
 
+  ePreallocA.addData("NonZeros", static_cast<int>(csr.columns.size()));
   ePreallocA.stop();
-  return vertexData;
 }
 
 } // namespace mapping
@@ -2,17 +2,36 @@
 
 #include "Mapping.hpp"
 #include "impl/BasisFunctions.hpp"
+#include "mesh/RTree.hpp"
 #include "utils/Event.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/ParallelFor.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/QR>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <limits>
+#include <mutex>
 
 namespace precice {
 extern bool syncMode;
 
 namespace mapping {
 
+/// Returns true, if the matrices of the given basis function are sparse enough for the sparse assembly.
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool useSparseAssembly(const RADIAL_BASIS_FUNCTION_T &function)
+{
+  return function.hasCompactSupport();
+}
+
+/// The support of a Gaussian is always cut off, but only a given support radius keeps it narrow.
+inline bool useSparseAssembly(const Gaussian &function)
+{
+  return function.hasExplicitSupportRadius();
+}
+
 /**
  * @brief Mapping with radial basis functions.
  *
@@ -23,6 +42,14 @@ namespace mapping {
  *
  * The radial basis function type has to be given as template parameter, and has
  * to be one of the defined types in this file.
+ *
+ * For basis functions with compact support, the interpolation and evaluation
+ * matrices are assembled as sparse matrices, using the vertex R-tree of the
+ * input mesh to find all pairs within the support radius. The interpolation
+ * matrix is then factorized with a sparse LDLT decomposition and the polynomial
+ * is resolved via its (small, dense) Schur complement. Basis functions with
+ * global support, including Gaussians without a given support radius, use
+ * the dense QR decomposition.
  */
 template <typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctMapping : public Mapping {
@@ -34,6 +61,7 @@ public:
    * @param[in] dimensions Dimensionality of the meshes
    * @param[in] function Radial basis function used for mapping.
    * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] threads Amount of threads to assemble the matrices with, 0 uses all hardware threads
    */
   RadialBasisFctMapping(
       Constraint              constraint,
@@ -41,7 +69,8 @@ public:
       RADIAL_BASIS_FUNCTION_T function,
       bool                    xDead,
       bool                    yDead,
-      bool                    zDead);
+      bool                    zDead,
+      int                     threads = 1);
 
   /// Computes the mapping coefficients from the in- and output mesh.
   virtual void computeMapping() override;
@@ -55,6 +84,9 @@ public:
   /// Maps input data to output data from input mesh to output mesh.
   virtual void map(int inputDataID, int outputDataID) override;
 
+  /// Maps all data fields together, solving for all components in one go.
+  virtual void mapBatch(const DataIDPairs &dataIDs) override;
+
   virtual void tagMeshFirstRound() override;
 
   virtual void tagMeshSecondRound() override;
@@ -64,18 +96,86 @@ private:
 
   bool _hasComputedMapping = false;
 
+  /// ID of the event of mapBatch(), registered by computeMapping()
+  int _mapDataEvent = -1;
+
   /// Radial basis function type used in interpolation.
   RADIAL_BASIS_FUNCTION_T _basisFunction;
 
+  /// true if the sparse representation is used, i.e., the basis function has compact support
+  bool _useSparse = false;
+
+  /// Amount of threads used to assemble the matrices
+  int _threads;
+
   Eigen::MatrixXd _matrixA;
 
   Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qr;
 
+  /// Sparse evaluation matrix, including the polynomial columns. Used instead of _matrixA.
+  Eigen::SparseMatrix<double> _sparseMatrixA;
+
+  /// Sparse LDLT factorization of the interpolation matrix without polynomial.
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> _sparseLDLT;
+
+  /// Polynomial part of the interpolation matrix, i.e., the input mesh coordinates.
+  Eigen::MatrixXd _matrixP;
+
+  /// Solution of C X = P, used to eliminate the polynomial from the sparse system.
+  Eigen::MatrixXd _matrixCinvP;
+
+  /// Factorization of the Schur complement P^T C^-1 P
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _schurQR;
+
   /// true if the mapping along some axis should be ignored
   std::vector<bool> _deadAxis;
 
-  /// Deletes all dead directions from fullVector and returns a vector of reduced dimensionality.
-  Eigen::VectorXd reduceVector(const Eigen::VectorXd &fullVector);
+  /// Returns the packed vertex coordinates of the mesh without the dead directions.
+  Eigen::MatrixXd getReducedCoordinates(const mesh::Mesh &mesh) const;
+
+  /// Assembles the dense interpolation matrix and factorizes it using a QR decomposition.
+  void computeDenseMapping(const mesh::PtrMesh &inMesh, const mesh::PtrMesh &outMesh, int polyparams);
+
+  /**
+   * @brief Fills the dense interpolation matrix C and the evaluation matrix A.
+   *
+   * @tparam Dim Rows of the reduced coordinates, fixed at compile time to unroll the distance computations
+   */
+  template <int Dim>
+  void fillDenseMatrices(const Eigen::MatrixXd &inCoords, const Eigen::MatrixXd &outCoords, Eigen::MatrixXd &matrixCLU);
+
+  /// Assembles the sparse interpolation and evaluation matrices and factorizes the system.
+  void computeSparseMapping(const mesh::PtrMesh &inMesh, const mesh::PtrMesh &outMesh, int polyparams);
+
+  /**
+   * @brief Returns all vertices of the tree within the support radius of the given vertex, considering dead axes.
+   *
+   * @param[in] tree Vertex tree of the input mesh
+   * @param[in] inCoords Reduced coordinates of the input mesh
+   * @param[in] vertex Vertex to query the support of
+   * @param[in] reducedCoords Reduced coordinates of vertex
+   * @param[out] neighbors Indices and distances of the vertices within the support
+   *
+   * Safe to call concurrently.
+   */
+  void querySupport(
+      const mesh::rtree::vertex_traits::Ptr &   tree,
+      const Eigen::MatrixXd &                   inCoords,
+      const mesh::Vertex &                      vertex,
+      const Eigen::Ref<const Eigen::VectorXd> &reducedCoords,
+      std::vector<std::pair<size_t, double>> &  neighbors) const;
+
+  /// Solves the interpolation system, including the polynomial, for all columns of the right-hand side.
+  Eigen::MatrixXd solveSystem(const Eigen::MatrixXd &rhs);
+
+  /// Computes A * x using either the dense or the sparse evaluation matrix.
+  Eigen::MatrixXd multiplyA(const Eigen::MatrixXd &x) const;
+
+  /// Computes A^T * x using either the dense or the sparse evaluation matrix.
+  Eigen::MatrixXd multiplyATransposed(const Eigen::MatrixXd &x) const;
+
+  /// Returns the number of rows and columns of the evaluation matrix.
+  std::pair<int, int> sizeA() const;
 
   void setDeadAxis(bool xDead, bool yDead, bool zDead)
   {
@@ -106,9 +206,12 @@ RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctMapping(
     RADIAL_BASIS_FUNCTION_T function,
     bool                    xDead,
     bool                    yDead,
-    bool                    zDead)
+    bool                    zDead,
+    int                     threads)
     : Mapping(constraint, dimensions),
-      _basisFunction(function)
+      _basisFunction(function),
+      _useSparse(useSparseAssembly(function)),
+      _threads(utils::resolveThreadCount(threads))
 {
   setInputRequirement(Mapping::MeshRequirement::VERTEX);
   setOutputRequirement(Mapping::MeshRequirement::VERTEX);
@@ -121,6 +224,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   PRECICE_TRACE();
 
   precice::utils::Event e("map.rbf.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  _mapDataEvent = getEventID("map.rbf.mapData");
 
   PRECICE_CHECK(not utils::MasterSlave::isSlave() && not utils::MasterSlave::isMaster(),
                 "RBF mapping is not supported for a participant in master mode, use petrbf instead");
@@ -140,7 +244,6 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     outMesh = output();
   }
   int inputSize      = (int) inMesh->vertices().size();
-  int outputSize     = (int) outMesh->vertices().size();
   int deadDimensions = 0;
   for (int d = 0; d < dimensions; d++) {
     if (_deadAxis[d])
@@ -148,27 +251,77 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   }
   int polyparams = 1 + dimensions - deadDimensions;
   PRECICE_ASSERT(inputSize >= 1 + polyparams, inputSize);
-  int             n = inputSize + polyparams; // Add linear polynom degrees
+
+  if (_useSparse) {
+    computeSparseMapping(inMesh, outMesh, polyparams);
+  } else {
+    computeDenseMapping(inMesh, outMesh, polyparams);
+  }
+
+  _hasComputedMapping = true;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeDenseMapping(
+    const mesh::PtrMesh &inMesh,
+    const mesh::PtrMesh &outMesh,
+    int                  polyparams)
+{
+  int             inputSize  = (int) inMesh->vertices().size();
+  int             outputSize = (int) outMesh->vertices().size();
+  int             n          = inputSize + polyparams; // Add linear polynom degrees
   Eigen::MatrixXd matrixCLU(n, n);
   matrixCLU.setZero();
   _matrixA = Eigen::MatrixXd(outputSize, n);
   _matrixA.setZero();
 
+  // The assembly visits every pair of vertices, hence it works on packed coordinates
+  const Eigen::MatrixXd inCoords  = getReducedCoordinates(*inMesh);
+  const Eigen::MatrixXd outCoords = getReducedCoordinates(*outMesh);
+  PRECICE_ASSERT(inCoords.rows() == polyparams - 1, inCoords.rows(), polyparams);
+
+  // Dispatch once to the reduced dimension, which lets the compiler unroll the distance computations
+  switch (inCoords.rows()) {
+  case 1:
+    fillDenseMatrices<1>(inCoords, outCoords, matrixCLU);
+    break;
+  case 2:
+    fillDenseMatrices<2>(inCoords, outCoords, matrixCLU);
+    break;
+  default:
+    PRECICE_ASSERT(inCoords.rows() == 3, inCoords.rows());
+    fillDenseMatrices<3>(inCoords, outCoords, matrixCLU);
+  }
+
+  _qr = matrixCLU.colPivHouseholderQr();
+  if (not _qr.isInvertible())
+    PRECICE_ERROR("Interpolation matrix C is not invertible.");
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <int Dim>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::fillDenseMatrices(
+    const Eigen::MatrixXd &inCoords,
+    const Eigen::MatrixXd &outCoords,
+    Eigen::MatrixXd &      matrixCLU)
+{
+  using Coordinates = Eigen::Matrix<double, Dim, Eigen::Dynamic>;
+  const Coordinates in         = inCoords;
+  const Coordinates out        = outCoords;
+  const int         inputSize  = in.cols();
+  const int         outputSize = out.cols();
+  const int         n          = matrixCLU.rows();
+
   // Fill upper right part (due to symmetry) of _matrixCLU with values
-  int             i = 0;
-  Eigen::VectorXd difference(dimensions);
-  for (const mesh::Vertex &iVertex : inMesh->vertices()) {
-    for (int j = iVertex.getID(); j < inputSize; j++) {
-      difference = iVertex.getCoords();
-      difference -= inMesh->vertices()[j].getCoords();
-      matrixCLU(i, j) = _basisFunction.evaluate(reduceVector(difference).norm());
-    }
-    matrixCLU(i, inputSize) = 1.0;
-    for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
-      matrixCLU(i, inputSize + 1 + dim) = reduceVector(iVertex.getCoords())[dim];
+  utils::parallelFor(inputSize, _threads, [&](size_t begin, size_t end) {
+    for (int i = begin; i < (int) end; i++) {
+      for (int j = i; j < inputSize; j++) {
+        matrixCLU(i, j) = _basisFunction.evaluate((in.col(i) - in.col(j)).norm());
+      }
+      matrixCLU(i, inputSize)                               = 1.0;
+      matrixCLU.row(i).template segment<Dim>(inputSize + 1) = in.col(i).transpose();
     }
-    i++;
-  }
+  });
   // Copy values of upper right part of C to lower left part
   for (int i = 0; i < n; i++) {
     for (int j = i + 1; j < n; j++) {
@@ -177,27 +330,132 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   }
 
   // Fill _matrixA with values
-  i = 0;
-  for (const mesh::Vertex &iVertex : outMesh->vertices()) {
-    int j = 0;
-    for (const mesh::Vertex &jVertex : inMesh->vertices()) {
-      difference = iVertex.getCoords();
-      difference -= jVertex.getCoords();
-      _matrixA(i, j) = _basisFunction.evaluate(reduceVector(difference).norm());
-      j++;
+  utils::parallelFor(outputSize, _threads, [&](size_t begin, size_t end) {
+    for (int i = begin; i < (int) end; i++) {
+      for (int j = 0; j < inputSize; j++) {
+        _matrixA(i, j) = _basisFunction.evaluate((out.col(i) - in.col(j)).norm());
+      }
+      _matrixA(i, inputSize)                               = 1.0;
+      _matrixA.row(i).template segment<Dim>(inputSize + 1) = out.col(i).transpose();
     }
-    _matrixA(i, inputSize) = 1.0;
-    for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
-      _matrixA(i, inputSize + 1 + dim) = reduceVector(iVertex.getCoords())[dim];
+  });
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeSparseMapping(
+    const mesh::PtrMesh &inMesh,
+    const mesh::PtrMesh &outMesh,
+    int                  polyparams)
+{
+  using Triplet = Eigen::Triplet<double>;
+
+  int inputSize  = (int) inMesh->vertices().size();
+  int outputSize = (int) outMesh->vertices().size();
+  int n          = inputSize + polyparams;
+
+  auto                  tree      = mesh::rtree::getVertexRTree(inMesh, _threads);
+  const Eigen::MatrixXd inCoords  = getReducedCoordinates(*inMesh);
+  const Eigen::MatrixXd outCoords = getReducedCoordinates(*outMesh);
+
+  // Every thread collects the entries of a block of rows, which are appended afterwards
+  std::vector<Triplet> entries;
+  std::mutex           entriesMutex;
+  auto                 appendEntries = [&](const std::vector<Triplet> &blockEntries) {
+    std::lock_guard<std::mutex> lock(entriesMutex);
+    entries.insert(entries.end(), blockEntries.begin(), blockEntries.end());
+  };
+
+  // Fill the lower triangular part of C, which is the only part read by the LDLT decomposition
+  precice::utils::Event eFillC("map.rbf.fillSparseC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  _matrixP = Eigen::MatrixXd(inputSize, polyparams);
+  utils::parallelFor(inputSize, _threads, [&](size_t begin, size_t end) {
+    std::vector<std::pair<size_t, double>> neighbors;
+    std::vector<Triplet>                   blockEntries;
+    for (int i = begin; i < (int) end; i++) {
+      querySupport(tree, inCoords, inMesh->vertices()[i], inCoords.col(i), neighbors);
+      for (const auto &neighbor : neighbors) {
+        if ((int) neighbor.first >= i)
+          blockEntries.emplace_back(neighbor.first, i, _basisFunction.evaluate(neighbor.second));
+      }
+      _matrixP(i, 0)                       = 1.0;
+      _matrixP.row(i).tail(polyparams - 1) = inCoords.col(i).transpose();
     }
-    i++;
-  }
+    appendEntries(blockEntries);
+  });
+  Eigen::SparseMatrix<double> matrixC(inputSize, inputSize);
+  matrixC.setFromTriplets(entries.begin(), entries.end());
+  entries.clear();
+  eFillC.stop();
+
+  // Fill _sparseMatrixA, the polynomial occupies the last polyparams columns
+  precice::utils::Event eFillA("map.rbf.fillSparseA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  utils::parallelFor(outputSize, _threads, [&](size_t begin, size_t end) {
+    std::vector<std::pair<size_t, double>> neighbors;
+    std::vector<Triplet>                   blockEntries;
+    for (int i = begin; i < (int) end; i++) {
+      querySupport(tree, inCoords, outMesh->vertices()[i], outCoords.col(i), neighbors);
+      for (const auto &neighbor : neighbors) {
+        blockEntries.emplace_back(i, neighbor.first, _basisFunction.evaluate(neighbor.second));
+      }
+      blockEntries.emplace_back(i, inputSize, 1.0);
+      for (int dim = 0; dim < polyparams - 1; dim++) {
+        blockEntries.emplace_back(i, inputSize + 1 + dim, outCoords(dim, i));
+      }
+    }
+    appendEntries(blockEntries);
+  });
+  _sparseMatrixA = Eigen::SparseMatrix<double>(outputSize, n);
+  _sparseMatrixA.setFromTriplets(entries.begin(), entries.end());
+  eFillA.stop();
+
+  precice::utils::Event eFactorize("map.rbf.factorizeSparse.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  _sparseLDLT.compute(matrixC);
+  if (_sparseLDLT.info() != Eigen::Success)
+    PRECICE_ERROR("Interpolation matrix C is not invertible.");
 
-  _qr = matrixCLU.colPivHouseholderQr();
-  if (not _qr.isInvertible())
+  // Eliminate the polynomial using the Schur complement P^T C^-1 P
+  _matrixCinvP = _sparseLDLT.solve(_matrixP);
+  _schurQR     = (_matrixP.transpose() * _matrixCinvP).colPivHouseholderQr();
+  if (not _schurQR.isInvertible())
     PRECICE_ERROR("Interpolation matrix C is not invertible.");
+  eFactorize.addData("NonZeros", static_cast<int>(matrixC.nonZeros()));
+}
 
-  _hasComputedMapping = true;
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::querySupport(
+    const mesh::rtree::vertex_traits::Ptr &   tree,
+    const Eigen::MatrixXd &                   inCoords,
+    const mesh::Vertex &                      vertex,
+    const Eigen::Ref<const Eigen::VectorXd> &reducedCoords,
+    std::vector<std::pair<size_t, double>> &  neighbors) const
+{
+  namespace bg = boost::geometry;
+  neighbors.clear();
+
+  // The search box is unbounded along dead axes, as they do not contribute to the distance
+  const double supportRadius = _basisFunction.getSupportRadius();
+  mesh::Box3d  box           = mesh::getEnclosingBox(vertex, supportRadius);
+  if (_deadAxis[0]) {
+    bg::set<bg::min_corner, 0>(box, std::numeric_limits<double>::lowest());
+    bg::set<bg::max_corner, 0>(box, std::numeric_limits<double>::max());
+  }
+  if (_deadAxis[1]) {
+    bg::set<bg::min_corner, 1>(box, std::numeric_limits<double>::lowest());
+    bg::set<bg::max_corner, 1>(box, std::numeric_limits<double>::max());
+  }
+  if (getDimensions() == 3 && _deadAxis[2]) {
+    bg::set<bg::min_corner, 2>(box, std::numeric_limits<double>::lowest());
+    bg::set<bg::max_corner, 2>(box, std::numeric_limits<double>::max());
+  }
+
+  std::vector<size_t> candidates;
+  tree->query(bg::index::within(box), std::back_inserter(candidates));
+
+  for (size_t candidate : candidates) {
+    const double norm = (inCoords.col(candidate) - reducedCoords).norm();
+    if (norm < supportRadius)
+      neighbors.emplace_back(candidate, norm);
+  }
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -212,6 +470,10 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
   PRECICE_TRACE();
   _matrixA            = Eigen::MatrixXd();
   _qr                 = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _sparseMatrixA      = Eigen::SparseMatrix<double>();
+  _matrixP            = Eigen::MatrixXd();
+  _matrixCinvP        = Eigen::MatrixXd();
+  _schurQR            = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
   _hasComputedMapping = false;
 }
 
@@ -221,8 +483,15 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
     int outputDataID)
 {
   PRECICE_TRACE(inputDataID, outputDataID);
+  mapBatch({{inputDataID, outputDataID}});
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapBatch(const DataIDPairs &dataIDs)
+{
+  PRECICE_TRACE(dataIDs.size());
 
-  precice::utils::Event e("map.rbf.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
 
   PRECICE_ASSERT(_hasComputedMapping);
   PRECICE_ASSERT(input()->getDimensions() == output()->getDimensions(),
@@ -230,11 +499,16 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
   PRECICE_ASSERT(getDimensions() == output()->getDimensions(),
                  getDimensions(), output()->getDimensions());
 
-  Eigen::VectorXd &inValues  = input()->data(inputDataID)->values();
-  Eigen::VectorXd &outValues = output()->data(outputDataID)->values();
-  int              valueDim  = input()->data(inputDataID)->getDimensions();
-  PRECICE_ASSERT(valueDim == output()->data(outputDataID)->getDimensions(),
-                 valueDim, output()->data(outputDataID)->getDimensions());
+  using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  // All components of all data fields are mapped as columns of one right-hand side
+  int rhsCols = 0;
+  for (const auto &ids : dataIDs) {
+    int valueDim = input()->data(ids.first)->getDimensions();
+    PRECICE_ASSERT(valueDim == output()->data(ids.second)->getDimensions(),
+                   valueDim, output()->data(ids.second)->getDimensions());
+    rhsCols += valueDim;
+  }
   int deadDimensions = 0;
   for (int d = 0; d < getDimensions(); d++) {
     if (_deadAxis[d])
@@ -242,59 +516,108 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
   }
   int polyparams = 1 + getDimensions() - deadDimensions;
 
+  const int rowsA = sizeA().first;  // rows == outputSize
+  const int colsA = sizeA().second; // cols == n
+  PRECICE_DEBUG("A rows=" << rowsA << " cols=" << colsA << ", right-hand sides=" << rhsCols);
+
   if (getConstraint() == CONSERVATIVE) {
     PRECICE_DEBUG("Map conservative");
-    static int      mappingIndex = 0;
-    Eigen::VectorXd Au(_matrixA.cols());  // rows == n
-    Eigen::VectorXd in(_matrixA.rows());  // rows == outputSize
-    Eigen::VectorXd out(_matrixA.cols()); // rows == n
-
-    // PRECICE_DEBUG("C rows=" << _matrixCLU.rows() << " cols=" << _matrixCLU.cols());
-    PRECICE_DEBUG("A rows=" << _matrixA.rows() << " cols=" << _matrixA.cols());
-    PRECICE_DEBUG("in size=" << in.size() << ", out size=" << out.size());
-
-    for (int dim = 0; dim < valueDim; dim++) {
-      for (int i = 0; i < in.size(); i++) { // Fill input data values
-        in[i] = inValues(i * valueDim + dim);
-      }
+    Eigen::MatrixXd in(rowsA, rhsCols);
+
+    // Fill input data values
+    int col = 0;
+    for (const auto &ids : dataIDs) {
+      const Eigen::VectorXd &inValues = input()->data(ids.first)->values();
+      const int              valueDim = input()->data(ids.first)->getDimensions();
+      in.middleCols(col, valueDim)    = Eigen::Map<const RowMajorMatrix>(inValues.data(), rowsA, valueDim);
+      col += valueDim;
+    }
 
-      Au  = _matrixA.transpose() * in;
-      out = _qr.solve(Au);
+    Eigen::MatrixXd out = solveSystem(multiplyATransposed(in));
 
-      // Copy mapped data to output data values
-      for (int i = 0; i < out.size() - polyparams; i++) {
-        outValues(i * valueDim + dim) = out[i];
-      }
+    // Copy mapped data to output data values
+    col = 0;
+    for (const auto &ids : dataIDs) {
+      Eigen::VectorXd &outValues = output()->data(ids.second)->values();
+      const int        valueDim  = output()->data(ids.second)->getDimensions();
+      Eigen::Map<RowMajorMatrix>(outValues.data(), colsA - polyparams, valueDim) =
+          out.block(0, col, colsA - polyparams, valueDim);
+      col += valueDim;
     }
-    mappingIndex++;
   } else { // Map consistent
     PRECICE_DEBUG("Map consistent");
-    Eigen::VectorXd p(_matrixA.cols());   // rows == n
-    Eigen::VectorXd in(_matrixA.cols());  // rows == n
-    Eigen::VectorXd out(_matrixA.rows()); // rows == outputSize
-    in.setZero();
-
-    // For every data dimension, perform mapping
-    for (int dim = 0; dim < valueDim; dim++) {
-      // Fill input from input data values (last polyparams entries remain zero)
-      for (int i = 0; i < in.size() - polyparams; i++) {
-        in[i] = inValues(i * valueDim + dim);
-      }
+    Eigen::MatrixXd in(colsA, rhsCols);
+    in.bottomRows(polyparams).setZero();
+
+    // Fill input from input data values (last polyparams entries remain zero)
+    int col = 0;
+    for (const auto &ids : dataIDs) {
+      const Eigen::VectorXd &inValues = input()->data(ids.first)->values();
+      const int              valueDim = input()->data(ids.first)->getDimensions();
+      in.block(0, col, colsA - polyparams, valueDim) =
+          Eigen::Map<const RowMajorMatrix>(inValues.data(), colsA - polyparams, valueDim);
+      col += valueDim;
+    }
 
-      p   = _qr.solve(in);
-      out = _matrixA * p;
+    Eigen::MatrixXd out = multiplyA(solveSystem(in));
 
-      // Copy mapped data to ouptut data values
-      for (int i = 0; i < out.size(); i++) {
-        outValues(i * valueDim + dim) = out[i];
-      }
+    // Copy mapped data to output data values
+    col = 0;
+    for (const auto &ids : dataIDs) {
+      Eigen::VectorXd &outValues = output()->data(ids.second)->values();
+      const int        valueDim  = output()->data(ids.second)->getDimensions();
+      Eigen::Map<RowMajorMatrix>(outValues.data(), rowsA, valueDim) = out.middleCols(col, valueDim);
+      col += valueDim;
     }
   }
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reduceVector(
-    const Eigen::VectorXd &fullVector)
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::solveSystem(
+    const Eigen::MatrixXd &rhs)
+{
+  if (not _useSparse)
+    return _qr.solve(rhs);
+
+  // Solves [C P; P^T 0] [x; b] = [f; g] by eliminating x = C^-1 (f - P b)
+  const int       inputSize  = _matrixP.rows();
+  const int       polyparams = _matrixP.cols();
+  Eigen::MatrixXd cInvF      = _sparseLDLT.solve(rhs.topRows(inputSize));
+  Eigen::MatrixXd solution(rhs.rows(), rhs.cols());
+  solution.bottomRows(polyparams) = _schurQR.solve(_matrixP.transpose() * cInvF - rhs.bottomRows(polyparams));
+  solution.topRows(inputSize)     = cInvF - _matrixCinvP * solution.bottomRows(polyparams);
+  return solution;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::multiplyA(
+    const Eigen::MatrixXd &x) const
+{
+  if (_useSparse)
+    return _sparseMatrixA * x;
+  return _matrixA * x;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::multiplyATransposed(
+    const Eigen::MatrixXd &x) const
+{
+  if (_useSparse)
+    return _sparseMatrixA.transpose() * x;
+  return _matrixA.transpose() * x;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::pair<int, int> RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::sizeA() const
+{
+  if (_useSparse)
+    return {_sparseMatrixA.rows(), _sparseMatrixA.cols()};
+  return {_matrixA.rows(), _matrixA.cols()};
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::getReducedCoordinates(
+    const mesh::Mesh &mesh) const
 {
   int deadDimensions = 0;
   for (int d = 0; d < getDimensions(); d++) {
@@ -302,15 +625,19 @@ Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reduceVector(
       deadDimensions += 1;
   }
   PRECICE_ASSERT(getDimensions() > deadDimensions, getDimensions(), deadDimensions);
-  Eigen::VectorXd reducedVector(getDimensions() - deadDimensions);
+  const Eigen::MatrixXd coordinates = mesh.getVertexCoordinates();
+  if (deadDimensions == 0) {
+    return coordinates;
+  }
+  Eigen::MatrixXd reducedCoordinates(getDimensions() - deadDimensions, coordinates.cols());
   int             k = 0;
   for (int d = 0; d < getDimensions(); d++) {
     if (not _deadAxis[d]) {
-      reducedVector[k] = fullVector[d];
+      reducedCoordinates.row(k) = coordinates.row(d);
       k++;
     }
   }
-  return reducedVector;
+  return reducedCoordinates;
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -6,10 +6,12 @@ namespace precice {
 namespace mapping {
 
 class Mapping;
+class MappingCache;
 class MappingConfiguration;
 
 using PtrMapping              = std::shared_ptr<Mapping>;
 using PtrMappingConfiguration = std::shared_ptr<MappingConfiguration>;
+using PtrMappingCache         = std::shared_ptr<MappingCache>;
 
 } // namespace mapping
 } // namespace precice
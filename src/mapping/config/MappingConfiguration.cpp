@@ -1,6 +1,8 @@
 #include "MappingConfiguration.hpp"
+#include "mapping/MappingCache.hpp"
 #include "mapping/NearestNeighborMapping.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
 #include "mapping/PetRadialBasisFctMapping.hpp"
 #include "mapping/RadialBasisFctMapping.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
@@ -37,8 +39,17 @@ MappingConfiguration::MappingConfiguration(
   auto attrPreallocation = makeXMLAttribute("preallocation", "tree")
                                .setDocumentation("Sets kind of preallocation for PETSc RBF implementation")
                                .setOptions({"estimate", "compute", "off", "save", "tree"});
+  auto attrSolver = makeXMLAttribute("solver", "default")
+                        .setDocumentation("Sets the solver and preconditioner of the PETSc RBF implementation. "
+                                          "The conjugate gradient presets require a positive definite system, e.g., "
+                                          "a compactly supported basis function without integrated polynomial. "
+                                          "Options given on the command line take precedence.")
+                        .setOptions({"default", "cg-bjacobi-icc", "cg-gamg", "cholesky"});
   auto attrUseLU = makeXMLAttribute(ATTR_USE_LU, false)
                        .setDocumentation("If set to true, LU decomposition is used to solve the RBF system (only supported in serial)");
+  auto attrThreads = makeXMLAttribute(ATTR_THREADS, 1)
+                         .setDocumentation("Number of threads used to compute the mapping. 0 uses all hardware threads. "
+                                           "RBF mappings use them to assemble their matrices, the PETSc variants only with saved or tree-based preallocation.");
 
   XMLTag::Occurrence occ = XMLTag::OCCUR_ARBITRARY;
   std::list<XMLTag>  tags;
@@ -85,17 +96,51 @@ MappingConfiguration::MappingConfiguration(
     tag.addAttribute(attrSolverRtol);
     tag.addAttribute(attrPolynomial);
     tag.addAttribute(attrPreallocation);
+    tag.addAttribute(attrSolver);
     tag.addAttribute(attrXDead);
     tag.addAttribute(attrYDead);
     tag.addAttribute(attrZDead);
     tag.addAttribute(attrUseLU);
+    tag.addAttribute(attrThreads);
   }
+  auto attrCache = makeXMLAttribute(ATTR_CACHE, "")
+                       .setDocumentation("Directory to store the computed mapping in. If the mapping is computed again from "
+                                         "identical meshes, e.g., when restarting a simulation, it is loaded from there. "
+                                         "Caching is disabled if left empty. Only supported with timing=\"initial\".");
   {
     XMLTag tag(*this, VALUE_NEAREST_NEIGHBOR, occ, TAG);
+    tag.addAttribute(attrCache);
+    tag.addAttribute(attrThreads);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_NEAREST_PROJECTION, occ, TAG);
+    tag.addAttribute(attrCache);
+    tag.addAttribute(attrThreads);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_RBF_POU, occ, TAG);
+    tag.setDocumentation("Radial basis function mapping solved on overlapping patches of the input mesh, "
+                         "whose results are blended by a partition of unity. There is no global system, "
+                         "hence it requires neither PETSc nor a global polynomial.");
+    auto attrBasisFunction = makeXMLAttribute(ATTR_BASIS_FUNCTION, VALUE_RBF_TPS)
+                                 .setDocumentation("Radial basis function used on every patch.")
+                                 .setOptions({VALUE_RBF_TPS, VALUE_RBF_MULTIQUADRICS, VALUE_RBF_INV_MULTIQUADRICS,
+                                              VALUE_RBF_VOLUME_SPLINES, VALUE_RBF_GAUSSIAN, VALUE_RBF_CTPS_C2,
+                                              VALUE_RBF_CPOLYNOMIAL_C0, VALUE_RBF_CPOLYNOMIAL_C6});
+    auto attrPatchVertices = makeXMLAttribute(ATTR_PATCH_VERTICES, 50)
+                                 .setDocumentation("Number of input vertices in the core of every patch.");
+    auto attrPatchOverlap = makeXMLAttribute(ATTR_PATCH_OVERLAP, 0.15)
+                                .setDocumentation("Enlargement of the patch radius relative to the radius of its core.");
+    tag.addAttribute(attrBasisFunction);
+    tag.addAttribute(makeXMLAttribute(ATTR_SHAPE_PARAM, 1.0)
+                         .setDocumentation("Shape parameter of the basis function, if required."));
+    tag.addAttribute(makeXMLAttribute(ATTR_SUPPORT_RADIUS, 1.0)
+                         .setDocumentation("Support radius of the basis function, if compactly supported."));
+    tag.addAttribute(attrPatchVertices);
+    tag.addAttribute(attrPatchOverlap);
+    tag.addAttribute(attrThreads);
     tags.push_back(tag);
   }
 
@@ -185,6 +230,34 @@ void MappingConfiguration::xmlTagCallback(
       else if (strPrealloc == "off")
         preallocation = Preallocation::OFF;
     }
+    SolverPreset solverPreset = SolverPreset::DEFAULT;
+    if (tag.hasAttribute("solver")) {
+      std::string strSolver = tag.getStringAttributeValue("solver");
+      if (strSolver == "cg-bjacobi-icc")
+        solverPreset = SolverPreset::CG_BJACOBI_ICC;
+      else if (strSolver == "cg-gamg")
+        solverPreset = SolverPreset::CG_GAMG;
+      else if (strSolver == "cholesky")
+        solverPreset = SolverPreset::CHOLESKY;
+    }
+    int threads = 1;
+    if (tag.hasAttribute(ATTR_THREADS)) {
+      threads = tag.getIntAttributeValue(ATTR_THREADS);
+      PRECICE_CHECK(threads >= 0, "The number of threads of a mapping has to be non-negative, but is " << threads << ".");
+    }
+
+    std::string basisFunction;
+    int         verticesPerPatch = 0;
+    double      relativeOverlap  = 0.0;
+    if (tag.hasAttribute(ATTR_BASIS_FUNCTION)) {
+      basisFunction = tag.getStringAttributeValue(ATTR_BASIS_FUNCTION);
+    }
+    if (tag.hasAttribute(ATTR_PATCH_VERTICES)) {
+      verticesPerPatch = tag.getIntAttributeValue(ATTR_PATCH_VERTICES);
+    }
+    if (tag.hasAttribute(ATTR_PATCH_OVERLAP)) {
+      relativeOverlap = tag.getDoubleAttributeValue(ATTR_PATCH_OVERLAP);
+    }
 
     ConfiguredMapping configuredMapping = createMapping(context,
                                                         dir, type, constraint,
@@ -192,7 +265,19 @@ void MappingConfiguration::xmlTagCallback(
                                                         shapeParameter, supportRadius, solverRtol,
                                                         xDead, yDead, zDead,
                                                         useLU,
-                                                        polynomial, preallocation);
+                                                        polynomial, preallocation, solverPreset,
+                                                        threads,
+                                                        basisFunction, verticesPerPatch, relativeOverlap);
+    if (tag.hasAttribute(ATTR_CACHE)) {
+      std::string cacheDirectory = tag.getStringAttributeValue(ATTR_CACHE);
+      if (not cacheDirectory.empty()) {
+        // Every computation of a non-initial mapping would add another file to the cache
+        PRECICE_CHECK(configuredMapping.timing == INITIAL,
+                      "The mapping from mesh \"" << configuredMapping.fromMesh->getName() << "\" to mesh \""
+                                                  << configuredMapping.toMesh->getName() << "\" can only be cached with timing=\"initial\".");
+        configuredMapping.mapping->setCache(std::make_shared<MappingCache>(cacheDirectory));
+      }
+    }
     checkDuplicates(configuredMapping);
     _mappings.push_back(configuredMapping);
   }
@@ -224,7 +309,12 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     bool                             zDead,
     bool                             useLU,
     Polynomial                       polynomial,
-    Preallocation                    preallocation) const
+    Preallocation                    preallocation,
+    SolverPreset                     solverPreset,
+    int                              threads,
+    const std::string &              basisFunction,
+    int                              verticesPerPatch,
+    double                           relativeOverlap) const
 {
   PRECICE_TRACE(direction, type, timing, shapeParameter, supportRadius);
   using namespace mapping;
@@ -257,14 +347,53 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
 
   if (type == VALUE_NEAREST_NEIGHBOR) {
     configuredMapping.mapping = PtrMapping(
-        new NearestNeighborMapping(constraintValue, dimensions));
+        new NearestNeighborMapping(constraintValue, dimensions, threads));
     configuredMapping.isRBF = false;
     return configuredMapping;
   } else if (type == VALUE_NEAREST_PROJECTION) {
     configuredMapping.mapping = PtrMapping(
-        new NearestProjectionMapping(constraintValue, dimensions));
+        new NearestProjectionMapping(constraintValue, dimensions, threads));
     configuredMapping.isRBF = false;
     return configuredMapping;
+  } else if (type == VALUE_RBF_POU) {
+    // The patches at the border of the local mesh need the vertices beyond it, hence no geometric filter is applied
+    configuredMapping.isRBF = true;
+    if (basisFunction == VALUE_RBF_TPS) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(),
+                                                        verticesPerPatch, relativeOverlap, threads));
+    } else if (basisFunction == VALUE_RBF_MULTIQUADRICS) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<Multiquadrics>(constraintValue, dimensions, Multiquadrics(shapeParameter),
+                                                     verticesPerPatch, relativeOverlap, threads));
+    } else if (basisFunction == VALUE_RBF_INV_MULTIQUADRICS) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<InverseMultiquadrics>(constraintValue, dimensions, InverseMultiquadrics(shapeParameter),
+                                                            verticesPerPatch, relativeOverlap, threads));
+    } else if (basisFunction == VALUE_RBF_VOLUME_SPLINES) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(),
+                                                     verticesPerPatch, relativeOverlap, threads));
+    } else if (basisFunction == VALUE_RBF_GAUSSIAN) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<Gaussian>(constraintValue, dimensions, Gaussian(shapeParameter),
+                                                verticesPerPatch, relativeOverlap, threads));
+    } else if (basisFunction == VALUE_RBF_CTPS_C2) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<CompactThinPlateSplinesC2>(constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius),
+                                                                 verticesPerPatch, relativeOverlap, threads));
+    } else if (basisFunction == VALUE_RBF_CPOLYNOMIAL_C0) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<CompactPolynomialC0>(constraintValue, dimensions, CompactPolynomialC0(supportRadius),
+                                                           verticesPerPatch, relativeOverlap, threads));
+    } else if (basisFunction == VALUE_RBF_CPOLYNOMIAL_C6) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<CompactPolynomialC6>(constraintValue, dimensions, CompactPolynomialC6(supportRadius),
+                                                           verticesPerPatch, relativeOverlap, threads));
+    } else {
+      PRECICE_ERROR("Unknown basis function \"" << basisFunction << "\" of partition of unity mapping!");
+    }
+    return configuredMapping;
   }
 
   // the mapping is a RBF mapping
@@ -300,34 +429,34 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
   if (not createPetRBF) {
     if (type == VALUE_RBF_TPS) {
       configuredMapping.mapping = PtrMapping(
-          new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), xDead, yDead, zDead));
+          new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), xDead, yDead, zDead, threads));
     } else if (type == VALUE_RBF_MULTIQUADRICS) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<Multiquadrics>(
-              constraintValue, dimensions, Multiquadrics(shapeParameter), xDead, yDead, zDead));
+              constraintValue, dimensions, Multiquadrics(shapeParameter), xDead, yDead, zDead, threads));
     } else if (type == VALUE_RBF_INV_MULTIQUADRICS) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<InverseMultiquadrics>(
-              constraintValue, dimensions, InverseMultiquadrics(shapeParameter), xDead, yDead, zDead));
+              constraintValue, dimensions, InverseMultiquadrics(shapeParameter), xDead, yDead, zDead, threads));
     } else if (type == VALUE_RBF_VOLUME_SPLINES) {
       configuredMapping.mapping = PtrMapping(
-          new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), xDead, yDead, zDead));
+          new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), xDead, yDead, zDead, threads));
     } else if (type == VALUE_RBF_GAUSSIAN) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<Gaussian>(
-              constraintValue, dimensions, Gaussian(shapeParameter), xDead, yDead, zDead));
+              constraintValue, dimensions, Gaussian(shapeParameter), xDead, yDead, zDead, threads));
     } else if (type == VALUE_RBF_CTPS_C2) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactThinPlateSplinesC2>(
-              constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), xDead, yDead, zDead));
+              constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), xDead, yDead, zDead, threads));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C0) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC0>(
-              constraintValue, dimensions, CompactPolynomialC0(supportRadius), xDead, yDead, zDead));
+              constraintValue, dimensions, CompactPolynomialC0(supportRadius), xDead, yDead, zDead, threads));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C6) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC6>(
-              constraintValue, dimensions, CompactPolynomialC6(supportRadius), xDead, yDead, zDead));
+              constraintValue, dimensions, CompactPolynomialC6(supportRadius), xDead, yDead, zDead, threads));
     } else {
       PRECICE_ERROR("Unknown mapping type!");
     }
@@ -339,35 +468,35 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     if (type == VALUE_RBF_TPS) {
       configuredMapping.mapping = PtrMapping(
           new PetRadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(),
-                                                         xDead, yDead, zDead, solverRtol, polynomial, preallocation));
+                                                         xDead, yDead, zDead, solverRtol, polynomial, preallocation, threads, solverPreset));
     } else if (type == VALUE_RBF_MULTIQUADRICS) {
       configuredMapping.mapping = PtrMapping(
           new PetRadialBasisFctMapping<Multiquadrics>(constraintValue, dimensions, Multiquadrics(shapeParameter),
-                                                      xDead, yDead, zDead, solverRtol, polynomial, preallocation));
+                                                      xDead, yDead, zDead, solverRtol, polynomial, preallocation, threads, solverPreset));
     } else if (type == VALUE_RBF_INV_MULTIQUADRICS) {
       configuredMapping.mapping = PtrMapping(
           new PetRadialBasisFctMapping<InverseMultiquadrics>(constraintValue, dimensions, InverseMultiquadrics(shapeParameter),
-                                                             xDead, yDead, zDead, solverRtol, polynomial, preallocation));
+                                                             xDead, yDead, zDead, solverRtol, polynomial, preallocation, threads, solverPreset));
     } else if (type == VALUE_RBF_VOLUME_SPLINES) {
       configuredMapping.mapping = PtrMapping(
           new PetRadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(),
-                                                      xDead, yDead, zDead, solverRtol, polynomial, preallocation));
+                                                      xDead, yDead, zDead, solverRtol, polynomial, preallocation, threads, solverPreset));
     } else if (type == VALUE_RBF_GAUSSIAN) {
       configuredMapping.mapping = PtrMapping(
           new PetRadialBasisFctMapping<Gaussian>(constraintValue, dimensions, Gaussian(shapeParameter),
-                                                 xDead, yDead, zDead, solverRtol, polynomial, preallocation));
+                                                 xDead, yDead, zDead, solverRtol, polynomial, preallocation, threads, solverPreset));
     } else if (type == VALUE_RBF_CTPS_C2) {
       configuredMapping.mapping = PtrMapping(
           new PetRadialBasisFctMapping<CompactThinPlateSplinesC2>(constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius),
-                                                                  xDead, yDead, zDead, solverRtol, polynomial, preallocation));
+                                                                  xDead, yDead, zDead, solverRtol, polynomial, preallocation, threads, solverPreset));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C0) {
       configuredMapping.mapping = PtrMapping(
           new PetRadialBasisFctMapping<CompactPolynomialC0>(constraintValue, dimensions, CompactPolynomialC0(supportRadius),
-                                                            xDead, yDead, zDead, solverRtol, polynomial, preallocation));
+                                                            xDead, yDead, zDead, solverRtol, polynomial, preallocation, threads, solverPreset));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C6) {
       configuredMapping.mapping = PtrMapping(
           new PetRadialBasisFctMapping<CompactPolynomialC6>(constraintValue, dimensions, CompactPolynomialC6(supportRadius),
-                                                            xDead, yDead, zDead, solverRtol, polynomial, preallocation));
+                                                            xDead, yDead, zDead, solverRtol, polynomial, preallocation, threads, solverPreset));
     } else {
       PRECICE_ERROR("Unknown mapping type!");
     }
@@ -30,6 +30,20 @@ enum class Preallocation {
   TREE
 };
 
+/// Which solver and preconditioner to use for the system of PETSc RBF mappings?
+/**
+ * DEFAULT: GMRES with the defaults of PETSc, which can be changed on the command line
+ * CG_BJACOBI_ICC: Conjugate gradients, preconditioned by block Jacobi with incomplete Cholesky on the blocks
+ * CG_GAMG: Conjugate gradients, preconditioned by algebraic multigrid
+ * CHOLESKY: Direct solution by a Cholesky factorization, using MUMPS if available
+ */
+enum class SolverPreset {
+  DEFAULT,
+  CG_BJACOBI_ICC,
+  CG_GAMG,
+  CHOLESKY
+};
+
 /// Performs XML configuration and holds configured mappings.
 class MappingConfiguration : public xml::XMLTag::Listener {
 public:
@@ -109,6 +123,11 @@ private:
   const std::string ATTR_Y_DEAD         = "y-dead";
   const std::string ATTR_Z_DEAD         = "z-dead";
   const std::string ATTR_USE_LU         = "use-lu-decomposition";
+  const std::string ATTR_CACHE          = "cache-directory";
+  const std::string ATTR_THREADS        = "threads";
+  const std::string ATTR_BASIS_FUNCTION = "basis-function";
+  const std::string ATTR_PATCH_VERTICES = "vertices-per-patch";
+  const std::string ATTR_PATCH_OVERLAP  = "relative-overlap";
 
   const std::string VALUE_WRITE        = "write";
   const std::string VALUE_READ         = "read";
@@ -125,6 +144,7 @@ private:
   const std::string VALUE_RBF_CTPS_C2           = "rbf-compact-tps-c2";
   const std::string VALUE_RBF_CPOLYNOMIAL_C0    = "rbf-compact-polynomial-c0";
   const std::string VALUE_RBF_CPOLYNOMIAL_C6    = "rbf-compact-polynomial-c6";
+  const std::string VALUE_RBF_POU               = "rbf-partition-of-unity";
 
   const std::string VALUE_TIMING_INITIAL    = "initial";
   const std::string VALUE_TIMING_ON_ADVANCE = "onadvance";
@@ -150,7 +170,12 @@ private:
       bool                             zDead,
       bool                             useLU,
       Polynomial                       polynomial,
-      Preallocation                    preallocation) const;
+      Preallocation                    preallocation,
+      SolverPreset                     solverPreset,
+      int                              threads,
+      const std::string &              basisFunction,
+      int                              verticesPerPatch,
+      double                           relativeOverlap) const;
 
   void checkDuplicates(const ConfiguredMapping &mapping);
 
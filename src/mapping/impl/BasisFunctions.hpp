@@ -141,7 +141,8 @@ class Gaussian {
 public:
   Gaussian(const double shape, const double supportRadius = std::numeric_limits<double>::infinity())
       : _shape(shape),
-        _supportRadius(supportRadius)
+        _supportRadius(supportRadius),
+        _hasExplicitSupportRadius(supportRadius != std::numeric_limits<double>::infinity())
   {
     PRECICE_CHECK(math::greater(_shape, 0.0),
                   "Shape parameter for radial-basis-function gaussian has to be larger than zero!");
@@ -159,6 +160,12 @@ public:
     return not(_supportRadius == std::numeric_limits<double>::infinity());
   }
 
+  /// True, if the support radius was given instead of derived from the cutoff threshold
+  bool hasExplicitSupportRadius() const
+  {
+    return _hasExplicitSupportRadius;
+  }
+
   double getSupportRadius() const
   {
     return _supportRadius;
@@ -184,6 +191,8 @@ private:
   double _supportRadius;
 
   double _deltaY = 0;
+
+  bool _hasExplicitSupportRadius;
 };
 
 /**
@@ -0,0 +1,208 @@
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include "mapping/MappingCache.hpp"
+#include "mapping/NearestNeighborMapping.hpp"
+#include "mapping/NearestProjectionMapping.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using precice::mapping::MappingCache;
+
+namespace {
+
+/// Creates an empty directory which is removed again on destruction.
+struct TemporaryDirectory {
+  boost::filesystem::path path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+
+  ~TemporaryDirectory()
+  {
+    boost::filesystem::remove_all(path);
+  }
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(MappingCacheTests, *testing::OnMaster())
+
+BOOST_AUTO_TEST_CASE(KeyDependsOnMeshes)
+{
+  Mesh inMesh("InMesh", 2, false, testing::nextMeshID());
+  inMesh.createVertex(Eigen::Vector2d(0.0, 0.0));
+  inMesh.createVertex(Eigen::Vector2d(1.0, 0.0));
+  Mesh outMesh("OutMesh", 2, false, testing::nextMeshID());
+  outMesh.createVertex(Eigen::Vector2d(0.5, 0.0));
+
+  const auto key = MappingCache::computeKey("nn", inMesh, outMesh);
+  BOOST_TEST(key == MappingCache::computeKey("nn", inMesh, outMesh));
+  BOOST_TEST(key != MappingCache::computeKey("np", inMesh, outMesh));
+  BOOST_TEST(key != MappingCache::computeKey("nn", outMesh, inMesh));
+
+  // Connectivity is part of the key
+  inMesh.createEdge(inMesh.vertices()[0], inMesh.vertices()[1]);
+  const auto keyWithEdge = MappingCache::computeKey("nn", inMesh, outMesh);
+  BOOST_TEST(key != keyWithEdge);
+
+  // Coordinates are part of the key
+  outMesh.vertices()[0].setCoords(Eigen::Vector2d(0.5, 1e-12));
+  BOOST_TEST(keyWithEdge != MappingCache::computeKey("nn", inMesh, outMesh));
+}
+
+BOOST_AUTO_TEST_CASE(StoreAndLoad)
+{
+  TemporaryDirectory dir;
+  MappingCache       cache(dir.path.string());
+
+  MappingCache::Entry entry;
+  BOOST_TEST(not cache.load(42, entry));
+
+  MappingCache::Entry stored{{3, 1, 4}, {0.5, 0.25}};
+  cache.store(42, stored);
+  BOOST_TEST(cache.load(42, entry));
+  BOOST_TEST(entry.indices == stored.indices);
+  BOOST_TEST(entry.values == stored.values);
+  BOOST_TEST(not cache.load(43, entry));
+}
+
+BOOST_AUTO_TEST_CASE(StoreFailsGracefully)
+{
+  TemporaryDirectory dir;
+  boost::filesystem::create_directories(dir.path);
+  // The cache directory cannot be created, as a regular file occupies its path
+  const boost::filesystem::path file = dir.path / "file";
+  std::ofstream(file.string()) << "occupied";
+  MappingCache cache((file / "cache").string());
+
+  cache.store(42, MappingCache::Entry{{3, 1, 4}, {}});
+  MappingCache::Entry entry;
+  BOOST_TEST(not cache.load(42, entry));
+}
+
+BOOST_AUTO_TEST_CASE(LoadRejectsCorruptFiles)
+{
+  TemporaryDirectory dir;
+  MappingCache       cache(dir.path.string());
+  cache.store(42, MappingCache::Entry{{3, 1, 4}, {0.5, 0.25}});
+  const boost::filesystem::path file = boost::filesystem::directory_iterator(dir.path)->path();
+
+  // The size of the indices follows the magic number, the version, and the key
+  const std::uint64_t hugeSize = std::uint64_t{1} << 60;
+  {
+    std::fstream stream(file.string(), std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(sizeof(std::uint64_t) + sizeof(std::uint32_t) + sizeof(std::uint64_t));
+    stream.write(reinterpret_cast<const char *>(&hugeSize), sizeof(hugeSize));
+  }
+  MappingCache::Entry entry;
+  BOOST_TEST(not cache.load(42, entry));
+
+  cache.store(42, MappingCache::Entry{{3, 1, 4}, {0.5, 0.25}});
+  boost::filesystem::resize_file(file, boost::filesystem::file_size(file) - 1);
+  BOOST_TEST(not cache.load(42, entry));
+  BOOST_TEST(std::distance(boost::filesystem::directory_iterator(dir.path), boost::filesystem::directory_iterator()) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(TaggingDoesNotStore)
+{
+  TemporaryDirectory dir;
+  auto               cache = std::make_shared<MappingCache>(dir.path.string());
+
+  PtrMesh inMesh(new Mesh("InMesh", 2, false, testing::nextMeshID()));
+  inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  PtrMesh outMesh(new Mesh("OutMesh", 2, false, testing::nextMeshID()));
+  outMesh->createVertex(Eigen::Vector2d(0.1, 0.0));
+
+  // The first round of tagging maps between the unfiltered meshes
+  mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, 2);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.setCache(cache);
+  mapping.tagMeshFirstRound();
+  BOOST_TEST(inMesh->vertices()[0].isTagged());
+  BOOST_TEST(not boost::filesystem::exists(dir.path));
+
+  mapping.computeMapping();
+  BOOST_TEST(not boost::filesystem::is_empty(dir.path));
+}
+
+BOOST_AUTO_TEST_CASE(NearestNeighborReusesEntry)
+{
+  TemporaryDirectory dir;
+  auto               cache = std::make_shared<MappingCache>(dir.path.string());
+
+  PtrMesh inMesh(new Mesh("InMesh", 2, false, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 1);
+  inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  inMesh->allocateDataValues();
+  inData->values() << 1.0, 2.0;
+
+  PtrMesh outMesh(new Mesh("OutMesh", 2, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  outMesh->createVertex(Eigen::Vector2d(0.1, 0.0));
+  outMesh->createVertex(Eigen::Vector2d(0.9, 0.0));
+  outMesh->allocateDataValues();
+
+  mapping::NearestNeighborMapping first(mapping::Mapping::CONSISTENT, 2);
+  first.setMeshes(inMesh, outMesh);
+  first.setCache(cache);
+  first.computeMapping();
+  first.map(inData->getID(), outData->getID());
+  BOOST_TEST(outData->values()(0) == 1.0);
+  BOOST_TEST(outData->values()(1) == 2.0);
+  BOOST_TEST(not boost::filesystem::is_empty(dir.path));
+
+  // A second mapping between the same meshes is loaded from the cache. It is
+  // a lookup, which we show by altering the stored entry beforehand.
+  const auto key = MappingCache::computeKey("nearest-neighbor:0:2", *inMesh, *outMesh);
+  cache->store(key, MappingCache::Entry{{1, 0}, {}});
+
+  mapping::NearestNeighborMapping second(mapping::Mapping::CONSISTENT, 2);
+  second.setMeshes(inMesh, outMesh);
+  second.setCache(cache);
+  second.computeMapping();
+  second.map(inData->getID(), outData->getID());
+  BOOST_TEST(outData->values()(0) == 2.0);
+  BOOST_TEST(outData->values()(1) == 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(NearestProjectionReusesWeights)
+{
+  TemporaryDirectory dir;
+  auto               cache = std::make_shared<MappingCache>(dir.path.string());
+
+  PtrMesh inMesh(new Mesh("InMesh", 2, false, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 1);
+  Vertex &v0     = inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  Vertex &v1     = inMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  inMesh->createEdge(v0, v1);
+  inMesh->computeState();
+  inMesh->allocateDataValues();
+  inData->values() << 1.0, 2.0;
+
+  PtrMesh outMesh(new Mesh("OutMesh", 2, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  outMesh->createVertex(Eigen::Vector2d(0.25, 0.1));
+  outMesh->allocateDataValues();
+
+  mapping::NearestProjectionMapping first(mapping::Mapping::CONSISTENT, 2);
+  first.setMeshes(inMesh, outMesh);
+  first.setCache(cache);
+  first.computeMapping();
+  first.map(inData->getID(), outData->getID());
+  const double expected = outData->values()(0);
+  BOOST_TEST(testing::equals(expected, 1.25));
+
+  mapping::NearestProjectionMapping second(mapping::Mapping::CONSISTENT, 2);
+  second.setMeshes(inMesh, outMesh);
+  second.setCache(cache);
+  second.computeMapping();
+  outData->values().setZero();
+  second.map(inData->getID(), outData->getID());
+  BOOST_TEST(outData->values()(0) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
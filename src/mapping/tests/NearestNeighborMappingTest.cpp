@@ -158,5 +158,46 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
   BOOST_TEST(outValues(1) == 0.0);
 }
 
+BOOST_AUTO_TEST_CASE(ThreadedMatchesSerial)
+{
+  int dimensions = 2;
+
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 1);
+  for (int i = 0; i < 50; i++) {
+    inMesh->createVertex(Eigen::Vector2d(0.13 * i, std::sin(0.5 * i)));
+  }
+  inMesh->allocateDataValues();
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  for (int i = 0; i < 101; i++) {
+    outMesh->createVertex(Eigen::Vector2d(0.067 * i, std::cos(0.3 * i)));
+  }
+  outMesh->allocateDataValues();
+
+  for (auto constraint : {mapping::Mapping::CONSISTENT, mapping::Mapping::CONSERVATIVE}) {
+    PtrMesh from     = constraint == mapping::Mapping::CONSISTENT ? inMesh : outMesh;
+    PtrMesh to       = constraint == mapping::Mapping::CONSISTENT ? outMesh : inMesh;
+    PtrData fromData = constraint == mapping::Mapping::CONSISTENT ? inData : outData;
+    PtrData toData   = constraint == mapping::Mapping::CONSISTENT ? outData : inData;
+    fromData->values().setLinSpaced(1.0, 2.0);
+
+    precice::mapping::NearestNeighborMapping serial(constraint, dimensions);
+    serial.setMeshes(from, to);
+    serial.computeMapping();
+    toData->values().setZero();
+    serial.map(fromData->getID(), toData->getID());
+    const Eigen::VectorXd expected = toData->values();
+
+    precice::mapping::NearestNeighborMapping threaded(constraint, dimensions, 3);
+    threaded.setMeshes(from, to);
+    threaded.computeMapping();
+    toData->values().setZero();
+    threaded.map(fromData->getID(), toData->getID());
+    BOOST_TEST(toData->values() == expected);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
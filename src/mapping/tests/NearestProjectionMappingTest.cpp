@@ -197,6 +197,45 @@ BOOST_AUTO_TEST_CASE(ConsistentNonIncremental2D)
   }
 }
 
+BOOST_AUTO_TEST_CASE(VectorData2D)
+{
+  using namespace mesh;
+  int dimensions = 2;
+
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 2);
+  Vertex &v1     = inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  Vertex &v2     = inMesh->createVertex(Eigen::Vector2d(1.0, 1.0));
+  inMesh->createEdge(v1, v2);
+  inMesh->computeState();
+  inMesh->allocateDataValues();
+  inData->values() << 1.0, 10.0, 2.0, 20.0;
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 2);
+  outMesh->createVertex(Eigen::Vector2d(0.25, 0.25));
+  outMesh->createVertex(Eigen::Vector2d(1.5, 1.5));
+  outMesh->allocateDataValues();
+
+  // Consistent mapping interpolates every component
+  mapping::NearestProjectionMapping consistent(mapping::Mapping::CONSISTENT, dimensions);
+  consistent.setMeshes(inMesh, outMesh);
+  consistent.computeMapping();
+  consistent.map(inData->getID(), outData->getID());
+  Eigen::VectorXd expected(4);
+  expected << 1.25, 12.5, 2.0, 20.0;
+  BOOST_TEST(testing::equals(outData->values(), expected));
+
+  // Conservative mapping distributes every component
+  mapping::NearestProjectionMapping conservative(mapping::Mapping::CONSERVATIVE, dimensions);
+  conservative.setMeshes(outMesh, inMesh);
+  conservative.computeMapping();
+  inData->values().setZero();
+  conservative.map(outData->getID(), inData->getID());
+  expected << 0.9375, 9.375, 2.3125, 23.125;
+  BOOST_TEST(testing::equals(inData->values(), expected));
+}
+
 BOOST_AUTO_TEST_CASE(ConsistentNonIncrementalPseudo3D)
 {
   using namespace mesh;
@@ -519,5 +558,61 @@ BOOST_AUTO_TEST_CASE(Query_3D_FullMesh)
   BOOST_TEST(outData->values()[0] == 1.0);
 }
 
+BOOST_AUTO_TEST_CASE(ThreadedMatchesSerial)
+{
+  using namespace precice::mesh;
+  constexpr int dimensions = 3;
+  constexpr int n          = 10;
+
+  // Create a triangulated, slightly curved surface to map from
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 1);
+  for (int i = 0; i <= n; i++) {
+    for (int j = 0; j <= n; j++) {
+      inMesh->createVertex(Eigen::Vector3d(i, j, 0.01 * i * j));
+    }
+  }
+  auto vertex = [&](int i, int j) -> Vertex & { return inMesh->vertices()[i * (n + 1) + j]; };
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      Edge &e0 = inMesh->createEdge(vertex(i, j), vertex(i + 1, j));
+      Edge &e1 = inMesh->createEdge(vertex(i + 1, j), vertex(i + 1, j + 1));
+      Edge &e2 = inMesh->createEdge(vertex(i + 1, j + 1), vertex(i, j));
+      Edge &e3 = inMesh->createEdge(vertex(i + 1, j + 1), vertex(i, j + 1));
+      Edge &e4 = inMesh->createEdge(vertex(i, j + 1), vertex(i, j));
+      inMesh->createTriangle(e0, e1, e2);
+      inMesh->createTriangle(e2, e3, e4);
+    }
+  }
+  inMesh->allocateDataValues();
+  inMesh->computeState();
+  for (size_t i = 0; i < inMesh->vertices().size(); i++) {
+    inData->values()(i) = inMesh->vertices()[i].getCoords().sum();
+  }
+
+  // Create points to map to, some of them outside of the surface
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  for (int i = 0; i < 200; i++) {
+    outMesh->createVertex(Eigen::Vector3d(0.061 * i - 1.0, 0.037 * i, 0.5));
+  }
+  outMesh->allocateDataValues();
+  outMesh->computeState();
+
+  precice::mapping::NearestProjectionMapping serial(mapping::Mapping::CONSISTENT, dimensions);
+  serial.setMeshes(inMesh, outMesh);
+  serial.computeMapping();
+  serial.map(inData->getID(), outData->getID());
+  const Eigen::VectorXd expected = outData->values();
+
+  precice::mapping::NearestProjectionMapping threaded(mapping::Mapping::CONSISTENT, dimensions, 4);
+  threaded.setMeshes(inMesh, outMesh);
+  threaded.computeMapping();
+  BOOST_TEST(threaded.hasComputedMapping() == true);
+  outData->values().setZero();
+  threaded.map(inData->getID(), outData->getID());
+  BOOST_TEST(outData->values() == expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,197 @@
+#include "testing/Fixtures.hpp"
+#include "testing/Testing.hpp"
+
+#include "com/MPIDirectCommunication.hpp"
+#include "m2n/GatherScatterComFactory.hpp"
+#include "m2n/M2N.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
+#include "math/math.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "partition/ReceivedPartition.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using precice::mapping::Mapping;
+using precice::mapping::PartitionOfUnityMapping;
+using precice::mapping::ThinPlateSplines;
+
+namespace {
+
+/// Creates a mesh with data on a regular grid of size^dimensions vertices, spaced by 1/(size-1) and shifted by offset.
+PtrMesh createGrid(const std::string &name, int dimensions, int size, double offset)
+{
+  PtrMesh mesh(new Mesh(name, dimensions, false, testing::nextMeshID()));
+  mesh->createData("Data", 1);
+  const int       count = dimensions == 2 ? size * size : size * size * size;
+  Eigen::VectorXd coords(dimensions);
+  for (int i = 0; i < count; i++) {
+    int index = i;
+    for (int d = 0; d < dimensions; d++) {
+      coords(d) = offset + static_cast<double>(index % size) / (size - 1);
+      index /= size;
+    }
+    mesh->createVertex(coords);
+  }
+  mesh->allocateDataValues();
+  return mesh;
+}
+
+/// Linear function reproduced exactly by every patch
+double linear(const Eigen::VectorXd &coords)
+{
+  return 1.0 + 2.0 * coords(0) - coords(1) + (coords.size() == 3 ? 0.5 * coords(2) : 0.0);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(PartitionOfUnity)
+
+#ifndef PRECICE_NO_MPI
+
+BOOST_AUTO_TEST_SUITE(Parallel, *testing::OnSize(4) * boost::unit_test::fixture<testing::MasterComFixture>())
+
+/// Receives a mesh on the master, which the slaves map from after the partitioning.
+BOOST_AUTO_TEST_CASE(ReceivedPartitionKeepsPatches)
+{
+  using precice::partition::ReceivedPartition;
+  const int dimensions = 2;
+  const int rank       = utils::Parallel::getProcessRank();
+
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 1);
+  if (rank == 0) {
+    const int size = 11;
+    for (int i = 0; i < size * size; i++) {
+      Vertex &v = inMesh->createVertex(Eigen::Vector2d(static_cast<double>(i % size) / (size - 1), static_cast<double>(i / size) / (size - 1)));
+      v.setGlobalIndex(i);
+    }
+    inMesh->setGlobalNumberOfVertices(size * size);
+  }
+
+  // Every slave provides a strip of the output mesh
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  if (rank > 0) {
+    for (int i = 0; i < 10; i++) {
+      outMesh->createVertex(Eigen::Vector2d((rank - 1 + 0.1 * (i % 5) + 0.3) / 3.0, 0.05 + 0.2 * (i / 2)));
+    }
+  }
+  outMesh->allocateDataValues();
+  outMesh->computeState();
+  outMesh->computeBoundingBox();
+
+  auto mapping = std::make_shared<PartitionOfUnityMapping<ThinPlateSplines>>(Mapping::CONSISTENT, dimensions, ThinPlateSplines(), 12, 0.2);
+  mapping->setMeshes(inMesh, outMesh);
+
+  // a ReceivedPartition needs exactly one m2n
+  com::PtrCommunication                     participantCom(new com::MPIDirectCommunication());
+  m2n::DistributedComFactory::SharedPointer distrFactory(new m2n::GatherScatterComFactory(participantCom));
+  m2n::PtrM2N                               m2n(new m2n::M2N(participantCom, distrFactory));
+
+  // Partition of unity mappings are configured without a geometric filter
+  ReceivedPartition part(inMesh, ReceivedPartition::NO_FILTER, 0.1);
+  part.setFromMapping(mapping);
+  part.addM2N(m2n);
+  part.compute();
+
+  if (rank == 0) {
+    BOOST_TEST(inMesh->vertices().empty());
+    return;
+  }
+  // The patches at the border of the strip reach beyond its bounding box
+  const auto bb      = outMesh->getBoundingBox();
+  bool       outside = false;
+  for (const Vertex &vertex : inMesh->vertices()) {
+    outside |= vertex.getCoords()(0) < bb[0].first or vertex.getCoords()(0) > bb[0].second;
+  }
+  BOOST_TEST(outside);
+
+  inMesh->allocateDataValues();
+  for (const Vertex &vertex : inMesh->vertices()) {
+    inData->values()(vertex.getID()) = linear(vertex.getCoords());
+  }
+  mapping->computeMapping();
+  mapping->map(inData->getID(), outData->getID());
+  for (const Vertex &vertex : outMesh->vertices()) {
+    BOOST_TEST(testing::equals(outData->values()(vertex.getID()), linear(vertex.getCoords()), 1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Parallel
+
+#endif // PRECICE_NO_MPI
+
+BOOST_AUTO_TEST_SUITE(Serial, *testing::OnMaster())
+
+BOOST_AUTO_TEST_CASE(ConsistentLinear)
+{
+  for (int dimensions : {2, 3}) {
+    PtrMesh inMesh  = createGrid("InMesh", dimensions, 6, 0.0);
+    PtrMesh outMesh = createGrid("OutMesh", dimensions, 5, 0.1);
+    for (const Vertex &vertex : inMesh->vertices()) {
+      inMesh->data()[0]->values()(vertex.getID()) = linear(vertex.getCoords());
+    }
+
+    PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, dimensions, ThinPlateSplines(), 12, 0.2);
+    mapping.setMeshes(inMesh, outMesh);
+    BOOST_TEST(not mapping.hasComputedMapping());
+    mapping.computeMapping();
+    BOOST_TEST(mapping.hasComputedMapping());
+    mapping.map(inMesh->data()[0]->getID(), outMesh->data()[0]->getID());
+
+    for (const Vertex &vertex : outMesh->vertices()) {
+      BOOST_TEST(testing::equals(outMesh->data()[0]->values()(vertex.getID()), linear(vertex.getCoords()), 1e-8));
+    }
+
+    mapping.clear();
+    BOOST_TEST(not mapping.hasComputedMapping());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConservativeSum)
+{
+  for (int dimensions : {2, 3}) {
+    PtrMesh inMesh  = createGrid("InMesh", dimensions, 5, 0.1);
+    PtrMesh outMesh = createGrid("OutMesh", dimensions, 6, 0.0);
+    for (const Vertex &vertex : inMesh->vertices()) {
+      inMesh->data()[0]->values()(vertex.getID()) = linear(vertex.getCoords());
+    }
+
+    PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSERVATIVE, dimensions, ThinPlateSplines(), 12, 0.2);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inMesh->data()[0]->getID(), outMesh->data()[0]->getID());
+
+    BOOST_TEST(testing::equals(outMesh->data()[0]->values().sum(), inMesh->data()[0]->values().sum(), 1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ThreadsYieldSameResult)
+{
+  PtrMesh inMesh  = createGrid("InMesh", 3, 6, 0.0);
+  PtrMesh outMesh = createGrid("OutMesh", 3, 7, -0.05);
+  for (const Vertex &vertex : inMesh->vertices()) {
+    inMesh->data()[0]->values()(vertex.getID()) = std::sin(vertex.getCoords().sum());
+  }
+
+  PartitionOfUnityMapping<ThinPlateSplines> serial(Mapping::CONSISTENT, 3, ThinPlateSplines(), 20, 0.15, 1);
+  serial.setMeshes(inMesh, outMesh);
+  serial.computeMapping();
+  serial.map(inMesh->data()[0]->getID(), outMesh->data()[0]->getID());
+  const Eigen::VectorXd expected = outMesh->data()[0]->values();
+
+  PartitionOfUnityMapping<ThinPlateSplines> threaded(Mapping::CONSISTENT, 3, ThinPlateSplines(), 20, 0.15, 4);
+  threaded.setMeshes(inMesh, outMesh);
+  threaded.computeMapping();
+  outMesh->data()[0]->values().setZero();
+  threaded.map(inMesh->data()[0]->getID(), outMesh->data()[0]->getID());
+  BOOST_TEST(testing::equals(outMesh->data()[0]->values(), expected));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Serial
+BOOST_AUTO_TEST_SUITE_END() // PartitionOfUnity
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
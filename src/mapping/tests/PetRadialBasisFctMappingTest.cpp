@@ -1299,6 +1299,24 @@ BOOST_AUTO_TEST_CASE(MapCompactThinPlateSplinesC2)
   perform3DTestConservativeMapping(conservativeMap3D);
 }
 
+BOOST_AUTO_TEST_CASE(MapThreadedAssembly)
+{
+  CompactThinPlateSplinesC2 fct(1.2);
+  using Mapping = PetRadialBasisFctMapping<CompactThinPlateSplinesC2>;
+  for (Preallocation preallocation : {Preallocation::TREE, Preallocation::SAVE}) {
+    for (Polynomial polynomial : {Polynomial::ON, Polynomial::SEPARATE}) {
+      Mapping consistentMap2D(Mapping::CONSISTENT, 2, fct, false, false, false, 1e-9, polynomial, preallocation, 4);
+      perform2DTestConsistentMapping(consistentMap2D);
+      Mapping consistentMap3D(Mapping::CONSISTENT, 3, fct, false, false, false, 1e-9, polynomial, preallocation, 4);
+      perform3DTestConsistentMapping(consistentMap3D);
+      Mapping conservativeMap2D(Mapping::CONSERVATIVE, 2, fct, false, false, false, 1e-9, polynomial, preallocation, 4);
+      perform2DTestConservativeMapping(conservativeMap2D);
+      Mapping conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, false, false, false, 1e-9, polynomial, preallocation, 4);
+      perform3DTestConservativeMapping(conservativeMap3D);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(MapPetCompactPolynomialC0)
 {
   double              supportRadius = 1.2;
@@ -1485,6 +1503,108 @@ BOOST_AUTO_TEST_CASE(SolutionCaching)
   BOOST_TEST(its == 0);
 }
 
+BOOST_AUTO_TEST_CASE(ReuseUnchangedMeshes)
+{
+  using Eigen::Vector2d;
+  int dimensions = 2;
+
+  CompactPolynomialC6                           fct(2.5);
+  PetRadialBasisFctMapping<CompactPolynomialC6> mapping(Mapping::CONSISTENT, dimensions, fct, false, false, false,
+                                                        1e-9, Polynomial::OFF, Preallocation::TREE, 1, SolverPreset::CG_BJACOBI_ICC);
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData   = inMesh->createData("InData", 1);
+  int           inDataID = inData->getID();
+  inMesh->createVertex(Vector2d(0.0, 0.0));
+  inMesh->createVertex(Vector2d(1.0, 0.0));
+  inMesh->createVertex(Vector2d(1.0, 1.0));
+  inMesh->createVertex(Vector2d(0.0, 1.0));
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  inData->values() << 1.0, 2.0, 2.0, 1.0;
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData   = outMesh->createData("OutData", 1);
+  int           outDataID = outData->getID();
+  outMesh->createVertex(Vector2d(0.5, 0.5));
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inDataID, outDataID);
+  double const expected = outData->values()[0];
+
+  // As in the coupling, the mapping is cleared after mapping and computed again.
+  // The meshes did not change, hence the solver, its preconditioner, and the previous solution are kept.
+  mapping.clear();
+  BOOST_TEST(not mapping.hasComputedMapping());
+  mapping.computeMapping();
+  BOOST_TEST(mapping.hasComputedMapping());
+  BOOST_TEST(mapping.previousSolution.size() == 1);
+  mapping.map(inDataID, outDataID);
+  BOOST_TEST(outData->values()[0] == expected);
+  PetscInt its;
+  KSPGetIterationNumber(mapping._solver, &its);
+  BOOST_TEST(its == 0);
+
+  // A changed mesh computes the mapping from scratch
+  mapping.clear();
+  inMesh->meshChanged(*inMesh);
+  mapping.computeMapping();
+  BOOST_TEST(mapping.hasComputedMapping());
+  BOOST_TEST(mapping.previousSolution.empty());
+  mapping.map(inDataID, outDataID);
+  BOOST_TEST(testing::equals(outData->values()[0], expected));
+}
+
+BOOST_AUTO_TEST_CASE(RemapAfterMeshChange)
+{
+  using Eigen::Vector2d;
+  int dimensions = 2;
+
+  ThinPlateSplines                           fct;
+  PetRadialBasisFctMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, dimensions, fct, false, false, false);
+
+  // Linear functions are reproduced due to the polynomial
+  auto function = [](const Eigen::VectorXd &x) { return 1.0 + x[0] + 2.0 * x[1]; };
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData   = inMesh->createData("InData", 1);
+  int           inDataID = inData->getID();
+  inMesh->createVertex(Vector2d(0.0, 0.0));
+  inMesh->createVertex(Vector2d(1.0, 0.0));
+  inMesh->createVertex(Vector2d(1.0, 1.0));
+  mesh::Vertex &moved = inMesh->createVertex(Vector2d(0.0, 1.0));
+  inMesh->createVertex(Vector2d(0.4, 0.6));
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData   = outMesh->createData("OutData", 1);
+  int           outDataID = outData->getID();
+  outMesh->createVertex(Vector2d(0.2, 0.3));
+  outMesh->createVertex(Vector2d(0.7, 0.9));
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  mapping.setMeshes(inMesh, outMesh);
+  for (int round = 0; round < 2; round++) {
+    for (const mesh::Vertex &v : inMesh->vertices()) {
+      inData->values()[v.getID()] = function(v.getCoords());
+    }
+    mapping.computeMapping();
+    mapping.map(inDataID, outDataID);
+    for (const mesh::Vertex &v : outMesh->vertices()) {
+      BOOST_TEST(testing::equals(outData->values()[v.getID()], function(v.getCoords()), 1e-6));
+    }
+
+    // Moving a vertex changes the revision of the mesh, hence the mapping is not reused
+    mapping.clear();
+    moved.setCoords(Vector2d(-0.5, 1.5));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ConsistentPolynomialSwitch,
                      *boost::unit_test::tolerance(1e-6))
 {
@@ -152,6 +152,158 @@ BOOST_AUTO_TEST_CASE(MapCompactPolynomialC6)
   perform3DTestConservativeMapping(conservativeMap3D);
 }
 
+BOOST_AUTO_TEST_CASE(SparseCompactSupport)
+{
+  int dimensions = 2;
+
+  // The support radius covers only a small neighborhood, such that C and A are truly sparse
+  double                                     supportRadius = 0.35;
+  CompactPolynomialC6                        fct(supportRadius);
+  RadialBasisFctMapping<CompactPolynomialC6> mapping(Mapping::CONSISTENT, dimensions, fct, false, false, false);
+
+  // Create mesh to map from on a regular grid and fill it with a linear function
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData   = inMesh->createData("InData", 1);
+  int           inDataID = inData->getID();
+  for (int i = 0; i <= 10; i++) {
+    for (int j = 0; j <= 10; j++) {
+      inMesh->createVertex(Eigen::Vector2d(0.1 * i, 0.1 * j));
+    }
+  }
+  inMesh->allocateDataValues();
+  for (const mesh::Vertex &v : inMesh->vertices()) {
+    inData->values()[v.getID()] = 1.0 + v.getCoords()[0] + 2.0 * v.getCoords()[1];
+  }
+
+  // Create mesh to map to
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData   = outMesh->createData("OutData", 1);
+  int           outDataID = outData->getID();
+  outMesh->createVertex(Eigen::Vector2d(0.05, 0.05));
+  outMesh->createVertex(Eigen::Vector2d(0.33, 0.71));
+  outMesh->createVertex(Eigen::Vector2d(0.9, 0.25));
+  outMesh->allocateDataValues();
+
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inDataID, outDataID);
+  BOOST_CHECK(mapping.hasComputedMapping());
+
+  // Linear functions are reproduced exactly due to the polynomial
+  for (const mesh::Vertex &v : outMesh->vertices()) {
+    double expected = 1.0 + v.getCoords()[0] + 2.0 * v.getCoords()[1];
+    BOOST_TEST(testing::equals(outData->values()[v.getID()], expected, 1e-10));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SparseAssemblySelection)
+{
+  BOOST_TEST(not useSparseAssembly(ThinPlateSplines()));
+  BOOST_TEST(useSparseAssembly(CompactPolynomialC6(0.5)));
+  // A Gaussian cuts off its support in any case, which stays wide without a given support radius
+  BOOST_TEST(Gaussian(1.0).hasCompactSupport());
+  BOOST_TEST(not useSparseAssembly(Gaussian(1.0)));
+  BOOST_TEST(useSparseAssembly(Gaussian(1.0, 0.5)));
+}
+
+BOOST_AUTO_TEST_CASE(MapBatch)
+{
+  int dimensions = 2;
+
+  ThinPlateSplines                        fct;
+  RadialBasisFctMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, dimensions, fct, false, false, false);
+
+  // Linear functions, which the mapping reproduces exactly due to the polynomial
+  auto vectorFunction = [](const Eigen::VectorXd &x) {
+    return Eigen::Vector2d(1.0 + x[0] + 2.0 * x[1], 3.0 - x[0] + 0.5 * x[1]);
+  };
+  auto scalarFunction = [](const Eigen::VectorXd &x) {
+    return 2.0 * x[0] - x[1];
+  };
+
+  // Create mesh to map from, holding a vector and a scalar data field
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inVectorData = inMesh->createData("InVectorData", 2);
+  mesh::PtrData inScalarData = inMesh->createData("InScalarData", 1);
+  inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(1.0, 1.0));
+  inMesh->createVertex(Eigen::Vector2d(0.0, 1.0));
+  inMesh->createVertex(Eigen::Vector2d(0.5, 0.4));
+  inMesh->allocateDataValues();
+  for (const mesh::Vertex &v : inMesh->vertices()) {
+    inVectorData->values().segment<2>(2 * v.getID()) = vectorFunction(v.getCoords());
+    inScalarData->values()[v.getID()]               = scalarFunction(v.getCoords());
+  }
+
+  // Create mesh to map to
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outVectorData = outMesh->createData("OutVectorData", 2);
+  mesh::PtrData outScalarData = outMesh->createData("OutScalarData", 1);
+  outMesh->createVertex(Eigen::Vector2d(0.2, 0.3));
+  outMesh->createVertex(Eigen::Vector2d(0.7, 0.9));
+  outMesh->allocateDataValues();
+
+  Eigen::VectorXd expectedVector(4);
+  Eigen::VectorXd expectedScalar(2);
+  for (const mesh::Vertex &v : outMesh->vertices()) {
+    expectedVector.segment<2>(2 * v.getID()) = vectorFunction(v.getCoords());
+    expectedScalar[v.getID()]               = scalarFunction(v.getCoords());
+  }
+
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+
+  // Map all fields at once
+  mapping.mapBatch({{inVectorData->getID(), outVectorData->getID()},
+                    {inScalarData->getID(), outScalarData->getID()}});
+  BOOST_TEST(testing::equals(outVectorData->values(), expectedVector, 1e-10));
+  BOOST_TEST(testing::equals(outScalarData->values(), expectedScalar, 1e-10));
+}
+
+/// Maps with the given basis function on one and on three threads, which have to yield identical results.
+template <typename RADIAL_BASIS_FUNCTION_T>
+void performThreadedMatchesSerial(RADIAL_BASIS_FUNCTION_T fct)
+{
+  int dimensions = 2;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", 1);
+  for (int i = 0; i < 50; i++) {
+    inMesh->createVertex(Eigen::Vector2d(0.02 * i, 0.5 + 0.4 * std::sin(0.5 * i)));
+  }
+  inMesh->allocateDataValues();
+  inData->values().setLinSpaced(1.0, 2.0);
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", 1);
+  for (int i = 0; i < 31; i++) {
+    outMesh->createVertex(Eigen::Vector2d(0.033 * i, 0.5 + 0.4 * std::cos(0.3 * i)));
+  }
+  outMesh->allocateDataValues();
+
+  RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T> serial(Mapping::CONSISTENT, dimensions, fct, false, false, false);
+  serial.setMeshes(inMesh, outMesh);
+  serial.computeMapping();
+  serial.map(inData->getID(), outData->getID());
+  const Eigen::VectorXd expected = outData->values();
+
+  RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T> threaded(Mapping::CONSISTENT, dimensions, fct, false, false, false, 3);
+  threaded.setMeshes(inMesh, outMesh);
+  threaded.computeMapping();
+  outData->values().setZero();
+  threaded.map(inData->getID(), outData->getID());
+  BOOST_TEST(outData->values() == expected);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadedMatchesSerial)
+{
+  // Dense assembly
+  performThreadedMatchesSerial(ThinPlateSplines());
+  // Sparse assembly
+  performThreadedMatchesSerial(CompactPolynomialC6(0.3));
+}
+
 BOOST_AUTO_TEST_CASE(DeadAxis2D)
 {
   int dimensions = 2;
@@ -4,96 +4,125 @@ namespace precice {
 namespace math {
 namespace barycenter {
 
-BarycentricCoordsAndProjected calcBarycentricCoordsForEdge(
-    const Eigen::VectorXd &edgeA,
-    const Eigen::VectorXd &edgeB,
-    const Eigen::VectorXd &edgeNormal,
-    const Eigen::VectorXd &location)
-{
-  using Eigen::Vector2d;
-  using Eigen::Vector3d;
-  using Eigen::VectorXd;
+namespace {
 
-  const int dimensions = edgeA.size();
-  PRECICE_ASSERT(dimensions == edgeB.size() && dimensions == edgeNormal.size() && dimensions == location.size(),
-                 "The inputs need to have the same dimensions.");
-  PRECICE_ASSERT((dimensions == 2) || (dimensions == 3), dimensions);
+using Eigen::Vector2d;
+using Eigen::Vector3d;
 
-  Vector2d barycentricCoords;
-  VectorXd projected = VectorXd::Zero(dimensions);
+/// The 2D representation of an edge p(s) = a + s(b-a) and a line q(t) = c + t(d-c) through the location
+struct EdgeSystem {
   Vector2d a, b, ab, c, d;
-  bool     collinear = false;
+};
 
-  if (dimensions == 2) {
-    // Get parameters for parametric edge representation: p(s) = a + s(b-a)
-    a  = edgeA.head<2>();
-    b  = edgeB.head<2>();
-    ab = b;
-    ab -= a;
-    // Same for intersecting normal from searchpoint: q(t) = c + t(d - c)
-    c = location.head<2>();
-    d = location.head<2>();
-    d += edgeNormal;
-    collinear = math::geometry::collinear(a, b, c);
-    if (collinear) {
-      // From p(s) = a + s(b-a) we get: s = (p(s) - a) / (b-a)
-      int iMax;
-      ab.cwiseAbs().maxCoeff(&iMax);
-      PRECICE_ASSERT(!math::equals(ab(iMax), 0.0));
-      barycentricCoords[0] = (location(iMax) - a(iMax)) / ab(iMax);
-      barycentricCoords[1] = 1.0 - barycentricCoords[0];
-      projected            = location.head<2>();
-      std::swap(barycentricCoords(0), barycentricCoords(1));
-      return {barycentricCoords, projected};
-    }
-  } else { // 3D
-    PRECICE_ASSERT(dimensions == 3, dimensions);
-    // Get parameters for parametric triangle representation: p(s) = a + s(b-a)
-    Vector3d a3D  = edgeA;
-    Vector3d b3D  = edgeB;
-    Vector3d c3D  = location;
-    Vector3d ab3D = b3D - a3D;
-    Vector3d ac3D = c3D - a3D;
-    collinear     = math::geometry::collinear(a3D, b3D, c3D);
-    if (collinear) {
-      // From p(s) = a + s(b-a) we get: s = (p(s) - a) / (b-a)
-      int iMax;
-      ab3D.cwiseAbs().maxCoeff(&iMax);
-      PRECICE_ASSERT(!math::equals(ab3D[iMax], 0.0));
-      barycentricCoords[0] =
-          (location(iMax) - edgeA(iMax)) / ab3D(iMax);
-      barycentricCoords[1] = 1.0 - barycentricCoords[0];
-      projected            = location;
-      std::swap(barycentricCoords(0), barycentricCoords(1));
-      return {barycentricCoords, projected};
-    }
-    // Project parameters to 2D, where the projection plane is determined from
-    // the normal direction, in order to prevent "faulty" projections.
-    Vector3d normal;
-    normal = ab3D.cross(ac3D);
-    int indexToRemove;
-    normal.cwiseAbs().maxCoeff(&indexToRemove);
-    int indices[2];
-    if (indexToRemove == 0) {
-      indices[0] = 1;
-      indices[1] = 2;
-    } else if (indexToRemove == 1) {
-      indices[0] = 0;
-      indices[1] = 2;
-    } else {
-      PRECICE_ASSERT(indexToRemove == 2, indexToRemove);
-      indices[0] = 0;
-      indices[1] = 1;
-    }
-    a << a3D[indices[0]], a3D[indices[1]];
-    b << b3D[indices[0]], b3D[indices[1]];
-    ab << ab3D[indices[0]], ab3D[indices[1]];
-    c << c3D[indices[0]], c3D[indices[1]];
-    // 3D normal might be projected out, hence, compute new 2D edge normal
-    Vector2d normal2D(-1.0 * ab(1), ab(0));
-    d = c + normal2D;
+/// Computes the barycentric coordinates of a location on the line of the edge, which is s = (p(s) - a) / (b-a)
+template <typename Vector>
+Vector2d collinearCoords(const Vector &edgeA, const Vector &ab, const Vector &location)
+{
+  int iMax;
+  ab.cwiseAbs().maxCoeff(&iMax);
+  PRECICE_ASSERT(!math::equals(ab(iMax), 0.0));
+  Vector2d barycentricCoords;
+  barycentricCoords[0] = (location(iMax) - edgeA(iMax)) / ab(iMax);
+  barycentricCoords[1] = 1.0 - barycentricCoords[0];
+  return barycentricCoords;
+}
+
+/** Sets up the 2D edge system.
+ *
+ * @return false and the barycentric coordinates if the location is collinear to the edge.
+ */
+bool setupEdgeSystem(
+    const Vector2d &edgeA,
+    const Vector2d &edgeB,
+    const Vector2d &edgeNormal,
+    const Vector2d &location,
+    EdgeSystem &    system,
+    Vector2d &      barycentricCoords)
+{
+  // Get parameters for parametric edge representation: p(s) = a + s(b-a)
+  system.a  = edgeA;
+  system.b  = edgeB;
+  system.ab = edgeB - edgeA;
+  // Same for intersecting normal from searchpoint: q(t) = c + t(d - c)
+  system.c = location;
+  system.d = location + edgeNormal;
+  if (math::geometry::collinear(system.a, system.b, system.c)) {
+    barycentricCoords = collinearCoords(edgeA, system.ab, location);
+    return false;
+  }
+  return true;
+}
+
+/// 3D variant of setupEdgeSystem(), which projects the edge to 2D
+bool setupEdgeSystem(
+    const Vector3d &edgeA,
+    const Vector3d &edgeB,
+    const Vector3d & /*edgeNormal*/,
+    const Vector3d &location,
+    EdgeSystem &    system,
+    Vector2d &      barycentricCoords)
+{
+  // Get parameters for parametric triangle representation: p(s) = a + s(b-a)
+  const Vector3d ab3D = edgeB - edgeA;
+  const Vector3d ac3D = location - edgeA;
+  if (math::geometry::collinear(edgeA, edgeB, location)) {
+    barycentricCoords = collinearCoords(edgeA, ab3D, location);
+    return false;
+  }
+  // Project parameters to 2D, where the projection plane is determined from
+  // the normal direction, in order to prevent "faulty" projections.
+  Vector3d normal = ab3D.cross(ac3D);
+  int      indexToRemove;
+  normal.cwiseAbs().maxCoeff(&indexToRemove);
+  int indices[2];
+  if (indexToRemove == 0) {
+    indices[0] = 1;
+    indices[1] = 2;
+  } else if (indexToRemove == 1) {
+    indices[0] = 0;
+    indices[1] = 2;
+  } else {
+    PRECICE_ASSERT(indexToRemove == 2, indexToRemove);
+    indices[0] = 0;
+    indices[1] = 1;
+  }
+  system.a << edgeA[indices[0]], edgeA[indices[1]];
+  system.b << edgeB[indices[0]], edgeB[indices[1]];
+  system.ab << ab3D[indices[0]], ab3D[indices[1]];
+  system.c << location[indices[0]], location[indices[1]];
+  // 3D normal might be projected out, hence, compute new 2D edge normal
+  Vector2d normal2D(-1.0 * system.ab(1), system.ab(0));
+  system.d = system.c + normal2D;
+  return true;
+}
+
+} // namespace
+
+template <int Dim>
+FixedBarycentricCoordsAndProjected<Dim, 2> calcBarycentricCoordsForEdge(
+    const Eigen::Matrix<double, Dim, 1> &edgeA,
+    const Eigen::Matrix<double, Dim, 1> &edgeB,
+    const Eigen::Matrix<double, Dim, 1> &edgeNormal,
+    const Eigen::Matrix<double, Dim, 1> &location)
+{
+  static_assert(Dim == 2 || Dim == 3, "Barycentric coordinates of edges are only defined in 2D and 3D");
+
+  FixedBarycentricCoordsAndProjected<Dim, 2> result;
+  EdgeSystem                                 system;
+  Vector2d &                                 barycentricCoords = result.barycentricCoords;
+
+  if (not setupEdgeSystem(edgeA, edgeB, edgeNormal, location, system, barycentricCoords)) {
+    result.projected = location;
+    std::swap(barycentricCoords(0), barycentricCoords(1));
+    return result;
   }
 
+  const Vector2d &a  = system.a;
+  const Vector2d &b  = system.b;
+  const Vector2d &ab = system.ab;
+  const Vector2d &c  = system.c;
+  const Vector2d &d  = system.d;
+
   // Compute denominator for solving 2x2 equation system
   double D = a(0) * (d(1) - c(1)) + b(0) * (c(1) - d(1)) + d(0) * ab(1) - c(0) * ab(1);
   PRECICE_ASSERT(not math::equals(D, 0.0), a, b, c, d, ab); // D == 0 would imply "normal // edge"
@@ -106,32 +135,49 @@ BarycentricCoordsAndProjected calcBarycentricCoordsForEdge(
                          D;
   barycentricCoords[1] = 1.0 - barycentricCoords[0];
 
-  // Compute coordinates of projected point, which has to be done dimension
-  // dependent again:
-  if (dimensions == 2) {
-    projected = ab;                    // = b - a
-    projected *= barycentricCoords[0]; // = bary0 * (b - a)
-    projected += a;                    // = a + bary0 * (b - a)
-  } else {
-    projected = edgeB;                 // = b
-    projected -= edgeA;                // = b - a
-    projected *= barycentricCoords[0]; // = bary0 * (b - a)
-    projected += edgeA;                // = a + bary0 * (b - a)
-  }
+  // Compute coordinates of projected point
+  result.projected = edgeB;                 // = b
+  result.projected -= edgeA;                // = b - a
+  result.projected *= barycentricCoords[0]; // = bary0 * (b - a)
+  result.projected += edgeA;                // = a + bary0 * (b - a)
 
   std::swap(barycentricCoords(0), barycentricCoords(1));
-  return {barycentricCoords, projected};
+  return result;
 }
 
-BarycentricCoordsAndProjected calcBarycentricCoordsForTriangle(
-    const Eigen::VectorXd &a,
-    const Eigen::VectorXd &b,
-    const Eigen::VectorXd &c,
-    const Eigen::VectorXd &normal,
+template FixedBarycentricCoordsAndProjected<2, 2> calcBarycentricCoordsForEdge<2>(
+    const Eigen::Vector2d &, const Eigen::Vector2d &, const Eigen::Vector2d &, const Eigen::Vector2d &);
+template FixedBarycentricCoordsAndProjected<3, 2> calcBarycentricCoordsForEdge<3>(
+    const Eigen::Vector3d &, const Eigen::Vector3d &, const Eigen::Vector3d &, const Eigen::Vector3d &);
+
+BarycentricCoordsAndProjected calcBarycentricCoordsForEdge(
+    const Eigen::VectorXd &edgeA,
+    const Eigen::VectorXd &edgeB,
+    const Eigen::VectorXd &edgeNormal,
     const Eigen::VectorXd &location)
 {
-  using Eigen::Vector2d;
-  using Eigen::Vector3d;
+  const int dimensions = edgeA.size();
+  PRECICE_ASSERT(dimensions == edgeB.size() && dimensions == edgeNormal.size() && dimensions == location.size(),
+                 "The inputs need to have the same dimensions.");
+  PRECICE_ASSERT((dimensions == 2) || (dimensions == 3), dimensions);
+
+  if (dimensions == 2) {
+    const auto result = calcBarycentricCoordsForEdge<2>(edgeA, edgeB, edgeNormal, location);
+    return {result.barycentricCoords, result.projected};
+  }
+  const auto result = calcBarycentricCoordsForEdge<3>(edgeA, edgeB, edgeNormal, location);
+  return {result.barycentricCoords, result.projected};
+}
+
+template <int Dim>
+FixedBarycentricCoordsAndProjected<Dim, 3> calcBarycentricCoordsForTriangle(
+    const Eigen::Matrix<double, Dim, 1> &a,
+    const Eigen::Matrix<double, Dim, 1> &b,
+    const Eigen::Matrix<double, Dim, 1> &c,
+    const Eigen::Matrix<double, Dim, 1> &normal,
+    const Eigen::Matrix<double, Dim, 1> &location)
+{
+  static_assert(Dim == 3, "Barycentric coordinates of triangles are only defined in 3D");
 
   // Parametric representation for triangle plane:
   // (x, y, z) * normal = d
@@ -180,6 +226,20 @@ BarycentricCoordsAndProjected calcBarycentricCoordsForTriangle(
   return {barycentricCoords, projected};
 }
 
+template FixedBarycentricCoordsAndProjected<3, 3> calcBarycentricCoordsForTriangle<3>(
+    const Eigen::Vector3d &, const Eigen::Vector3d &, const Eigen::Vector3d &, const Eigen::Vector3d &, const Eigen::Vector3d &);
+
+BarycentricCoordsAndProjected calcBarycentricCoordsForTriangle(
+    const Eigen::VectorXd &a,
+    const Eigen::VectorXd &b,
+    const Eigen::VectorXd &c,
+    const Eigen::VectorXd &normal,
+    const Eigen::VectorXd &location)
+{
+  const auto result = calcBarycentricCoordsForTriangle<3>(a, b, c, normal, location);
+  return {result.barycentricCoords, result.projected};
+}
+
 BarycentricCoordsAndProjected calcBarycentricCoordsForQuad(
     const Eigen::VectorXd &a,
     const Eigen::VectorXd &b,
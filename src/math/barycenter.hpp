@@ -17,6 +17,19 @@ struct BarycentricCoordsAndProjected {
   Eigen::VectorXd projected;
 };
 
+/** The result of calculating the barycentric coordinates with a compile-time dimension.
+ *
+ * @tparam Dim the spatial dimension
+ * @tparam Corners the amount of corner points of the primitive
+ */
+template <int Dim, int Corners>
+struct FixedBarycentricCoordsAndProjected {
+  /// A vector of the n coefficients for n vertices
+  Eigen::Matrix<double, Corners, 1> barycentricCoords;
+  /// The projected location vertex
+  Eigen::Matrix<double, Dim, 1> projected;
+};
+
 /** Takes the corner vertices of an edge and its norm.
  *  It then calculates the projection of a location vector and generates the barycentric coordinates for the corner points.
  *
@@ -32,6 +45,17 @@ BarycentricCoordsAndProjected calcBarycentricCoordsForEdge(
     const Eigen::VectorXd &edgeNormal,
     const Eigen::VectorXd &location);
 
+/** Variant of calcBarycentricCoordsForEdge() for fixed-size vectors, which does not allocate.
+ *
+ * Instantiated for Dim 2 and 3.
+ */
+template <int Dim>
+FixedBarycentricCoordsAndProjected<Dim, 2> calcBarycentricCoordsForEdge(
+    const Eigen::Matrix<double, Dim, 1> &edgeA,
+    const Eigen::Matrix<double, Dim, 1> &edgeB,
+    const Eigen::Matrix<double, Dim, 1> &edgeNormal,
+    const Eigen::Matrix<double, Dim, 1> &location);
+
 /** Takes the corner vertices of a triangle and its norm.
  *  It then calculates the projection of a location vector and generates the barycentric coordinates for the corner points.
  *
@@ -53,6 +77,18 @@ BarycentricCoordsAndProjected calcBarycentricCoordsForTriangle(
     const Eigen::VectorXd &normal,
     const Eigen::VectorXd &location);
 
+/** Variant of calcBarycentricCoordsForTriangle() for fixed-size vectors, which does not allocate.
+ *
+ * Instantiated for Dim 3.
+ */
+template <int Dim>
+FixedBarycentricCoordsAndProjected<Dim, 3> calcBarycentricCoordsForTriangle(
+    const Eigen::Matrix<double, Dim, 1> &a,
+    const Eigen::Matrix<double, Dim, 1> &b,
+    const Eigen::Matrix<double, Dim, 1> &c,
+    const Eigen::Matrix<double, Dim, 1> &normal,
+    const Eigen::Matrix<double, Dim, 1> &location);
+
 /** Takes the corner vertices of a quad and its norm.
  *  It then calculates the projection of a location vector and generates the barycentric coordinates for the corner points.
  *
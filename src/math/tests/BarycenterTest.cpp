@@ -55,6 +55,28 @@ BOOST_AUTO_TEST_CASE(BarycenterEdge)
   }
 }
 
+BOOST_AUTO_TEST_CASE(BarycenterEdge2D)
+{
+  using Eigen::Vector2d;
+  using Eigen::VectorXd;
+  using precice::testing::equals;
+  Vector2d a(0.0, 0.0);
+  Vector2d b(1.0, 1.0);
+  Vector2d n(-1.0, 1.0);
+  Vector2d l(1.0, 0.0);
+  Vector2d projected(0.5, 0.5);
+  Vector2d coords(0.5, 0.5);
+
+  auto ret = calcBarycentricCoordsForEdge(a, b, n, l);
+  BOOST_TEST(equals(ret.projected, projected));
+  BOOST_TEST(equals(ret.barycentricCoords, coords));
+
+  // The dynamic variant gives the same result
+  auto retX = calcBarycentricCoordsForEdge(VectorXd(a), VectorXd(b), VectorXd(n), VectorXd(l));
+  BOOST_TEST(equals(retX.projected, ret.projected));
+  BOOST_TEST(equals(retX.barycentricCoords, ret.barycentricCoords));
+}
+
 BOOST_AUTO_TEST_CASE(BarycenterTriangle)
 {
   using Eigen::Vector3d;
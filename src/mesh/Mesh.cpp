@@ -3,6 +3,7 @@
 #include <Eigen/Geometry>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <boost/container/flat_map.hpp>
 #include "Edge.hpp"
 #include "Quad.hpp"
@@ -14,6 +15,11 @@
 namespace precice {
 namespace mesh {
 
+namespace {
+/// The last revision assigned to any mesh
+std::atomic<std::uint64_t> lastRevision{0};
+} // namespace
+
 Mesh::Mesh(
     const std::string &name,
     int                dimensions,
@@ -27,7 +33,8 @@ Mesh::Mesh(
   PRECICE_ASSERT((_dimensions == 2) || (_dimensions == 3), _dimensions);
   PRECICE_ASSERT(_name != std::string(""));
 
-  meshChanged.connect([](Mesh &m) { rtree::clear(m); });
+  updateRevision();
+  meshChanged.connect([](Mesh &m) { m.updateRevision(); });
   meshDestroyed.connect([](Mesh &m) { rtree::clear(m); });
 }
 
@@ -76,6 +83,15 @@ const Mesh::QuadContainer &Mesh::quads() const
   return _quads;
 }
 
+Eigen::MatrixXd Mesh::getVertexCoordinates() const
+{
+  Eigen::MatrixXd coordinates(_dimensions, _vertices.size());
+  for (size_t i = 0; i < _vertices.size(); i++) {
+    coordinates.col(i) = _vertices[i].getCoords();
+  }
+  return coordinates;
+}
+
 int Mesh::getDimensions() const
 {
   return _dimensions;
@@ -86,6 +102,7 @@ Edge &Mesh::createEdge(
     Vertex &vertexTwo)
 {
   _edges.emplace_back(vertexOne, vertexTwo, _manageEdgeIDs.getFreeID());
+  updateRevision();
   return _edges.back();
 }
 
@@ -118,6 +135,7 @@ Triangle &Mesh::createTriangle(
           edgeThree.connectedTo(edgeOne),
       "Edges are not connected!");
   _triangles.emplace_back(edgeOne, edgeTwo, edgeThree, _manageTriangleIDs.getFreeID());
+  updateRevision();
   return _triangles.back();
 }
 
@@ -128,6 +146,7 @@ Quad &Mesh::createQuad(
     Edge &edgeFour)
 {
   _quads.emplace_back(edgeOne, edgeTwo, edgeThree, edgeFour, _manageQuadIDs.getFreeID());
+  updateRevision();
   return _quads.back();
 }
 
@@ -404,6 +423,16 @@ void Mesh::addMesh(
   meshChanged(*this);
 }
 
+std::uint64_t Mesh::getRevision() const
+{
+  return _revision;
+}
+
+void Mesh::updateRevision()
+{
+  _revision = ++lastRevision;
+}
+
 const Mesh::BoundingBox Mesh::getBoundingBox() const
 {
   return _boundingBox;
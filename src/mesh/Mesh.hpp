@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/signals2.hpp>
+#include <cstdint>
 #include <deque>
 #include <list>
 #include <map>
@@ -44,7 +45,7 @@ public:
   /// A mapping from remote local ranks to the IDs that must be communicated
   using CommunicationMap = std::map<int, std::vector<int>>;
 
-  /// Signal is emitted when the mesh is changed
+  /// Signal is emitted when the mesh is changed, which also updates the revision of the mesh
   boost::signals2::signal<void(Mesh &)> meshChanged;
 
   /// Signal is emitted when the mesh is destroyed
@@ -94,6 +95,15 @@ public:
   /// Returns const container holding all quads.
   const QuadContainer &quads() const;
 
+  /**
+   * @brief Returns the coordinates of all vertices packed into a contiguous matrix.
+   *
+   * Column i holds the coordinates of vertices()[i]. Loops visiting many
+   * vertices, possibly repeatedly, should work on this copy instead of
+   * accessing every Vertex.
+   */
+  Eigen::MatrixXd getVertexCoordinates() const;
+
   int getDimensions() const;
 
   template <typename VECTOR_T>
@@ -101,6 +111,8 @@ public:
   {
     PRECICE_ASSERT(coords.size() == _dimensions, coords.size(), _dimensions);
     _vertices.emplace_back(coords, _manageVertexIDs.getFreeID());
+    _vertices.back()._mesh = this;
+    updateRevision();
     return _vertices.back();
   }
 
@@ -247,6 +259,16 @@ public:
    */
   const std::vector<double> getCOG() const;
 
+  /**
+   * @brief Returns the revision of the geometry of the mesh.
+   *
+   * The revision changes whenever primitives are created, vertices are moved,
+   * the mesh is cleared, or meshChanged is emitted. Revisions are unique among
+   * all meshes, hence they can be used to identify structures computed from a
+   * mesh, such as its index trees.
+   */
+  std::uint64_t getRevision() const;
+
   bool operator==(const Mesh &other) const;
 
   bool operator!=(const Mesh &other) const;
@@ -254,6 +276,14 @@ public:
 private:
   mutable logging::Logger _log{"mesh::Mesh"};
 
+  /// Assigns a new revision to the mesh.
+  void updateRevision();
+
+  friend class Vertex;
+
+  /// Revision of the geometry, see getRevision()
+  std::uint64_t _revision;
+
   /// Name of the mesh.
   std::string _name;
 
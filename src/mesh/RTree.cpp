@@ -3,35 +3,73 @@
 
 #include <boost/range/irange.hpp>
 #include "mesh/RTree.hpp"
+#include "utils/Event.hpp"
+#include "utils/ParallelFor.hpp"
 
 namespace precice {
 namespace mesh {
 
 namespace bg = boost::geometry;
 
+namespace {
+
+/// Returns the bounding box of the first vertices of a primitive, non-existing dimensions are zero
+template <typename Primitive>
+AABB computeBox(const Primitive &primitive, int vertexCount)
+{
+  AABB box;
+  bg::convert(primitive.vertex(0), box.min_corner());
+  box.max_corner() = box.min_corner();
+  for (int i = 1; i < vertexCount; ++i) {
+    bg::expand(box, primitive.vertex(i));
+  }
+  return box;
+}
+
+} // namespace
+
 // Initialize static member
 std::map<int, rtree::MeshIndices> precice::mesh::rtree::_cached_trees;
-std::map<int, PtrPrimitiveRTree>  precice::mesh::rtree::_primitive_trees;
 
-rtree::MeshIndices &rtree::cacheEntry(int meshID)
+rtree::MeshIndices &rtree::cacheEntry(const Mesh &mesh)
 {
-  auto result = _cached_trees.emplace(std::make_pair(meshID, rtree::MeshIndices{}));
-  return result.first->second;
+  auto &entry = _cached_trees[mesh.getID()];
+  if (entry.revision != mesh.getRevision()) {
+    entry          = MeshIndices{};
+    entry.revision = mesh.getRevision();
+  }
+  return entry;
 }
 
-rtree::vertex_traits::Ptr rtree::getVertexRTree(const PtrMesh &mesh)
+void rtree::recordCacheHit()
+{
+  utils::Event("rtree.cacheHit", utils::Event::Clock::duration::zero());
+}
+
+rtree::vertex_traits::Ptr rtree::getVertexRTree(const PtrMesh &mesh, int threads)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
+  auto &cache = cacheEntry(*mesh);
   if (cache.vertices) {
+    recordCacheHit();
     return cache.vertices;
   }
+  utils::Event e("rtree.cacheMiss");
 
   // Generating the rtree is expensive, so passing everything in the ctor is
   // the best we can do. Even passing an index range instead of calling
   // tree->insert repeatedly is about 10x faster.
+  // The tree visits the coordinates many times during construction and queries,
+  // hence we pack them once instead of accessing the vertices.
+  auto points = std::make_shared<impl::PackedPoints>(mesh->vertices().size());
+  utils::parallelFor(points->size(), threads, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      bg::convert(mesh->vertices()[i], (*points)[i]);
+    }
+  });
+
   RTreeParameters            params;
-  vertex_traits::IndexGetter ind(mesh->vertices());
+  vertex_traits::IndexGetter ind(points);
   auto                       tree = std::make_shared<vertex_traits::RTree>(
       boost::irange<std::size_t>(0lu, mesh->vertices().size()), params, ind);
 
@@ -39,19 +77,32 @@ rtree::vertex_traits::Ptr rtree::getVertexRTree(const PtrMesh &mesh)
   return tree;
 }
 
-rtree::edge_traits::Ptr rtree::getEdgeRTree(const PtrMesh &mesh)
+rtree::edge_traits::Ptr rtree::getEdgeRTree(const PtrMesh &mesh, int threads)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
+  auto &cache = cacheEntry(*mesh);
   if (cache.edges) {
+    recordCacheHit();
     return cache.edges;
   }
+  utils::Event e("rtree.cacheMiss");
 
   // Generating the rtree is expensive, so passing everything in the ctor is
   // the best we can do. Even passing an index range instead of calling
   // tree->insert repeatedly is about 10x faster.
+  // The tree visits the segments many times during construction and queries,
+  // hence we pack them once instead of accessing the vertices of the edges.
+  const auto &edges    = mesh->edges();
+  auto        segments = std::make_shared<impl::PackedSegments>(edges.size());
+  utils::parallelFor(segments->size(), threads, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      bg::convert(edges[i].vertex(0), (*segments)[i].first);
+      bg::convert(edges[i].vertex(1), (*segments)[i].second);
+    }
+  });
+
   RTreeParameters          params;
-  edge_traits::IndexGetter ind(mesh->edges());
+  edge_traits::IndexGetter ind(segments);
   auto                     tree = std::make_shared<edge_traits::RTree>(
       boost::irange<std::size_t>(0lu, mesh->edges().size()), params, ind);
 
@@ -59,23 +110,26 @@ rtree::edge_traits::Ptr rtree::getEdgeRTree(const PtrMesh &mesh)
   return tree;
 }
 
-rtree::triangle_traits::Ptr rtree::getTriangleRTree(const PtrMesh &mesh)
+rtree::triangle_traits::Ptr rtree::getTriangleRTree(const PtrMesh &mesh, int threads)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
+  auto &cache = cacheEntry(*mesh);
   if (cache.triangles) {
+    recordCacheHit();
     return cache.triangles;
   }
+  utils::Event e("rtree.cacheMiss");
 
   // We first generate the values for the triangle rtree.
   // The resulting vector is a random access range, which can be passed to the
   // constructor of the rtree for more efficient indexing.
-  std::vector<triangle_traits::IndexType> elements;
-  elements.reserve(mesh->triangles().size());
-  for (size_t i = 0; i < mesh->triangles().size(); ++i) {
-    auto box = bg::return_envelope<RTreeBox>(mesh->triangles()[i]);
-    elements.emplace_back(std::move(box), i);
-  }
+  const auto &                            triangles = mesh->triangles();
+  std::vector<triangle_traits::IndexType> elements(triangles.size());
+  utils::parallelFor(elements.size(), threads, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      elements[i] = std::make_pair(computeBox(triangles[i], 3), i);
+    }
+  });
 
   // Generating the rtree is expensive, so passing everything in the ctor is
   // the best we can do.
@@ -89,27 +143,24 @@ rtree::triangle_traits::Ptr rtree::getTriangleRTree(const PtrMesh &mesh)
 PtrPrimitiveRTree rtree::getPrimitiveRTree(const PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh, "Empty meshes are not allowed.");
-  auto iter = _primitive_trees.find(mesh->getID());
-  if (iter != _primitive_trees.end()) {
-    return iter->second;
+  auto &cache = cacheEntry(*mesh);
+  if (cache.primitives) {
+    recordCacheHit();
+    return cache.primitives;
   }
-  auto treeptr = std::make_shared<PrimitiveRTree>(indexMesh(*mesh));
-  _primitive_trees.emplace(std::piecewise_construct,
-                           std::forward_as_tuple(mesh->getID()),
-                           std::forward_as_tuple(treeptr));
-  return treeptr;
+  utils::Event e("rtree.cacheMiss");
+  cache.primitives = std::make_shared<PrimitiveRTree>(indexMesh(*mesh));
+  return cache.primitives;
 }
 
 void rtree::clear(Mesh &mesh)
 {
   _cached_trees.erase(mesh.getID());
-  _primitive_trees.erase(mesh.getID());
 }
 
 void rtree::clear()
 {
   _cached_trees.clear();
-  _primitive_trees.clear();
 }
 
 Box3d getEnclosingBox(Vertex const &middlePoint, double sphereRadius)
@@ -133,13 +184,16 @@ PrimitiveRTree indexMesh(const Mesh &mesh)
 {
   using namespace impl;
 
-  AABBGenerator  gen{mesh};
-  PrimitiveRTree tree;
-  indexPrimitive(tree, gen, mesh.vertices());
-  indexPrimitive(tree, gen, mesh.edges());
-  indexPrimitive(tree, gen, mesh.triangles());
-  indexPrimitive(tree, gen, mesh.quads());
-  return tree;
+  // Bulk-loading all values in the ctor results in a better tree and is
+  // considerably faster than inserting the primitives one by one.
+  AABBGenerator                           gen{mesh};
+  std::vector<PrimitiveRTree::value_type> values;
+  values.reserve(mesh.vertices().size() + mesh.edges().size() + mesh.triangles().size() + mesh.quads().size());
+  indexPrimitive(values, gen, mesh.vertices());
+  indexPrimitive(values, gen, mesh.edges());
+  indexPrimitive(values, gen, mesh.triangles());
+  indexPrimitive(values, gen, mesh.quads());
+  return PrimitiveRTree(values);
 }
 
 std::ostream &operator<<(std::ostream &out, Primitive val)
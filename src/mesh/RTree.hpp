@@ -71,8 +71,8 @@ bool operator!=(const PrimitiveIndex &lhs, const PrimitiveIndex &rhs);
 /// A standard print operator for PrimitiveIndex
 std::ostream &operator<<(std::ostream &out, PrimitiveIndex val);
 
-/// The axis aligned bounding box based on the Vertex Type
-using AABB = boost::geometry::model::box<Eigen::VectorXd>;
+/// The axis aligned bounding box of fixed dimension, non-existing dimensions are zero
+using AABB = impl::PackedBoxes::value_type;
 
 /// The rtree capable of indexing primitives of an entire Mesh
 using PrimitiveRTree = boost::geometry::index::rtree<std::pair<AABB, PrimitiveIndex>, boost::geometry::index::rstar<16>>;
@@ -82,7 +82,8 @@ using PtrPrimitiveRTree = std::shared_ptr<PrimitiveRTree>;
 
 /** Indexes a given mesh and returns a PrimitiveRTree holding the index
  *
- * This indexes the vertices, edges, triangles, and quads of a given Mesh and retrurns the index tree
+ * This indexes the vertices, edges, triangles, and quads of a given Mesh and retrurns the index tree.
+ * The bounding boxes of all primitives are collected first and bulk-loaded into the tree.
  *
  * \param mesh the mesh to index
  *
@@ -175,6 +176,45 @@ struct RTreeTraits {
   using Ptr   = std::shared_ptr<RTree>;
 };
 
+/// Vertices are indexed by their coordinates, which the tree keeps packed in a contiguous buffer
+template <>
+struct RTreeTraits<Vertex> {
+  using MeshContainer      = PrimitiveTraits<Vertex>::MeshContainer;
+  using MeshContainerIndex = MeshContainer::size_type;
+
+  using IndexType   = MeshContainerIndex;
+  using IndexGetter = impl::PackedPointIndexable;
+
+  using RTree = boost::geometry::index::rtree<IndexType, RTreeParameters, IndexGetter>;
+  using Ptr   = std::shared_ptr<RTree>;
+};
+
+/// Edges are indexed by their segments, which the tree keeps packed in a contiguous buffer
+template <>
+struct RTreeTraits<Edge> {
+  using MeshContainer      = PrimitiveTraits<Edge>::MeshContainer;
+  using MeshContainerIndex = MeshContainer::size_type;
+
+  using IndexType   = MeshContainerIndex;
+  using IndexGetter = impl::PackedSegmentIndexable;
+
+  using RTree = boost::geometry::index::rtree<IndexType, RTreeParameters, IndexGetter>;
+  using Ptr   = std::shared_ptr<RTree>;
+};
+
+/// Triangles are indexed by their bounding boxes, which are stored next to their index in the tree
+template <>
+struct RTreeTraits<Triangle> {
+  using MeshContainer      = PrimitiveTraits<Triangle>::MeshContainer;
+  using MeshContainerIndex = MeshContainer::size_type;
+
+  using IndexType   = std::pair<AABB, MeshContainerIndex>;
+  using IndexGetter = boost::geometry::index::indexable<IndexType>;
+
+  using RTree = boost::geometry::index::rtree<IndexType, RTreeParameters, IndexGetter>;
+  using Ptr   = std::shared_ptr<RTree>;
+};
+
 class rtree {
 public:
   using vertex_traits   = RTreeTraits<Vertex>;
@@ -183,21 +223,30 @@ public:
 
   /// Returns the pointer to boost::geometry::rtree for the given mesh vertices
   /*
-   * Creates and fills the tree, if it wasn't requested before, otherwise it returns the cached tree.
+   * Creates and fills the tree, if it wasn't requested before for the current revision of the mesh,
+   * otherwise it returns the cached tree. Hits and misses of the cache are recorded as the events
+   * rtree.cacheHit and rtree.cacheMiss, where the latter measures the construction of the tree.
+   * The coordinates or bounding boxes of the primitives are computed on the given amount of threads,
+   * and bulk-loaded into the tree afterwards.
    */
-  static vertex_traits::Ptr getVertexRTree(const PtrMesh &mesh);
+  static vertex_traits::Ptr getVertexRTree(const PtrMesh &mesh, int threads = 1);
 
-  static edge_traits::Ptr getEdgeRTree(const PtrMesh &mesh);
+  static edge_traits::Ptr getEdgeRTree(const PtrMesh &mesh, int threads = 1);
 
-  static triangle_traits::Ptr getTriangleRTree(const PtrMesh &mesh);
+  static triangle_traits::Ptr getTriangleRTree(const PtrMesh &mesh, int threads = 1);
 
   /// Returns the pointer to boost::geometry::rtree for the given mesh primitives
   /*
-   * Creates and fills the tree, if it wasn't requested before, otherwise it returns the cached tree.
+   * Creates and fills the tree, if it wasn't requested before for the current revision of the mesh,
+   * otherwise it returns the cached tree.
    */
   static PtrPrimitiveRTree getPrimitiveRTree(const PtrMesh &mesh);
 
   /// Only clear the trees of that specific mesh
+  /*
+   * Trees of outdated revisions of a mesh are replaced on the next request,
+   * hence this is only required to release the memory of the trees.
+   */
   static void clear(Mesh &mesh);
 
   /// Clear the complete cache
@@ -206,19 +255,25 @@ public:
   friend struct MeshTests::RTree::CacheClearing;
 
 private:
+  /// The trees of one revision of a mesh
   struct MeshIndices {
+    std::uint64_t        revision = 0;
     vertex_traits::Ptr   vertices;
     edge_traits::Ptr     edges;
     triangle_traits::Ptr triangles;
+    PtrPrimitiveRTree    primitives;
   };
 
-  static MeshIndices &cacheEntry(int MeshID);
+  /// Returns the cached trees of the current revision of the mesh, dropping trees of older revisions.
+  static MeshIndices &cacheEntry(const Mesh &mesh);
+
+  /// Records a hit of the cache
+  static void recordCacheHit();
 
-  static std::map<int, MeshIndices>       _cached_trees;    ///< Cache for all index trees
-  static std::map<int, PtrPrimitiveRTree> _primitive_trees; ///< Cache for the primitive trees
+  static std::map<int, MeshIndices> _cached_trees; ///< Cache for all index trees
 };
 
-using Box3d = boost::geometry::model::box<boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>>;
+using Box3d = AABB;
 
 /// Returns a boost::geometry box that encloses a sphere of given radius around a middle point
 Box3d getEnclosingBox(Vertex const &middlePoint, double sphereRadius);
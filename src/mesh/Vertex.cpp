@@ -1,4 +1,5 @@
 #include "Vertex.hpp"
+#include "Mesh.hpp"
 #include "utils/EigenIO.hpp"
 
 namespace precice {
@@ -44,6 +45,13 @@ void Vertex::tag()
   _tagged = true;
 }
 
+void Vertex::coordinatesChanged()
+{
+  if (_mesh) {
+    _mesh->updateRevision();
+  }
+}
+
 std::ostream &operator<<(std::ostream &os, Vertex const &v)
 {
   return os << "POINT (" << v.getCoords().transpose().format(utils::eigenio::wkt()) << ')';
@@ -8,6 +8,8 @@
 namespace precice {
 namespace mesh {
 
+class Mesh;
+
 /// Vertex of a mesh.
 class Vertex {
 public:
@@ -80,6 +82,14 @@ private:
 
   /// true if this vertex is tagged for partition
   bool _tagged = false;
+
+  /// Mesh which created the vertex, its revision changes when the vertex is moved
+  Mesh *_mesh = nullptr;
+
+  /// Renews the revision of the mesh of the vertex.
+  void coordinatesChanged();
+
+  friend class Mesh;
 };
 
 // ------------------------------------------------------ HEADER IMPLEMENTATION
@@ -100,6 +110,7 @@ void Vertex::setCoords(
 {
   PRECICE_ASSERT(coordinates.size() == _coords.size(), coordinates.size(), _coords.size());
   _coords = coordinates;
+  coordinatesChanged();
 }
 
 template <typename VECTOR_T>
@@ -108,6 +119,7 @@ void Vertex::setCoords(
 {
   PRECICE_ASSERT(coordinates.size() == _coords.size(), coordinates.size(), _coords.size());
   _coords = std::forward<VECTOR_T>(coordinates);
+  coordinatesChanged();
 }
 
 template <typename VECTOR_T>
@@ -63,6 +63,25 @@ void indexPrimitive(PrimitiveRTree &rtree, const Generator &gen, const Container
   }
 }
 
+/** collects the values of a container of primitives to bulk-load them into an rtree.
+ *
+ * The algorithm generates the value of every primitive of the given container like indexPrimitive(),
+ * but appends it to the given values instead of inserting it into a tree.
+ *
+ * @param[IN, OUT] values the values to append to
+ * @param gen the Generator generating something to index rtree::value_type.
+ * @param conti the Container to index
+ */
+template <typename Container, typename Generator = AABBGenerator>
+void indexPrimitive(std::vector<PrimitiveRTree::value_type> &values, const Generator &gen, const Container &conti)
+{
+  using ValueType = typename std::remove_reference<typename std::remove_cv<typename Container::value_type>::type>::type;
+  for (size_t i = 0; i < conti.size(); ++i) {
+    PrimitiveIndex index{as_primitive_enum<ValueType>::value, i};
+    values.emplace_back(gen(index), index);
+  }
+}
+
 } // namespace impl
 } // namespace mesh
 } // namespace precice
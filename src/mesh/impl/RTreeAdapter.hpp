@@ -2,6 +2,8 @@
 
 #include <Eigen/Core>
 #include <boost/geometry.hpp>
+#include <memory>
+#include <vector>
 #include "mesh/Edge.hpp"
 #include "mesh/Vertex.hpp"
 
@@ -274,6 +276,60 @@ public:
   }
 };
 
+/// Vertex coordinates packed into a contiguous buffer, non-existing dimensions are zero
+using PackedPoints = std::vector<boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>>;
+
+/** Makes PackedPoints indexable and thus be usable in boost::geometry::rtree
+ *
+ * The rtree stores a copy of the indexable, which shares the ownership of the points.
+ */
+class PackedPointIndexable {
+public:
+  using result_type = const PackedPoints::value_type &;
+
+  explicit PackedPointIndexable(std::shared_ptr<const PackedPoints> points)
+      : _points(std::move(points))
+  {
+  }
+
+  result_type operator()(PackedPoints::size_type i) const
+  {
+    return (*_points)[i];
+  }
+
+private:
+  std::shared_ptr<const PackedPoints> _points;
+};
+
+/// Bounding boxes of primitives packed into a contiguous buffer, non-existing dimensions are zero
+using PackedBoxes = std::vector<boost::geometry::model::box<PackedPoints::value_type>>;
+
+/// Segments of edges packed into a contiguous buffer, non-existing dimensions are zero
+using PackedSegments = std::vector<boost::geometry::model::segment<PackedPoints::value_type>>;
+
+/** Makes PackedSegments indexable and thus be usable in boost::geometry::rtree
+ *
+ * The rtree stores a copy of the indexable, which shares the ownership of the segments.
+ * Indexing segments instead of their bounding boxes keeps distances in nearest queries exact.
+ */
+class PackedSegmentIndexable {
+public:
+  using result_type = const PackedSegments::value_type &;
+
+  explicit PackedSegmentIndexable(std::shared_ptr<const PackedSegments> segments)
+      : _segments(std::move(segments))
+  {
+  }
+
+  result_type operator()(PackedSegments::size_type i) const
+  {
+    return (*_segments)[i];
+  }
+
+private:
+  std::shared_ptr<const PackedSegments> _segments;
+};
+
 } // namespace impl
 } // namespace mesh
 } // namespace precice
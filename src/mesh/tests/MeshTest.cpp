@@ -244,6 +244,23 @@ BOOST_AUTO_TEST_CASE(BoundingBoxCOG_3D)
   }
 }
 
+BOOST_AUTO_TEST_CASE(VertexCoordinates)
+{
+  Eigen::Vector3d coords0(2, 0, -3);
+  Eigen::Vector3d coords1(-1, 4, 8);
+
+  mesh::Mesh mesh("3D Testmesh", 3, false, testing::nextMeshID());
+  BOOST_TEST(mesh.getVertexCoordinates().size() == 0);
+  mesh.createVertex(coords0);
+  mesh.createVertex(coords1);
+
+  Eigen::MatrixXd coordinates = mesh.getVertexCoordinates();
+  BOOST_TEST(coordinates.rows() == 3);
+  BOOST_TEST(coordinates.cols() == 2);
+  BOOST_TEST(testing::equals(coordinates.col(0), coords0));
+  BOOST_TEST(testing::equals(coordinates.col(1), coords1));
+}
+
 BOOST_AUTO_TEST_CASE(Demonstration)
 {
   for (int dim = 2; dim <= 3; dim++) {
@@ -491,5 +508,36 @@ BOOST_AUTO_TEST_CASE(ComputeStateOfNotFullyConnectedMesh)
   }
 }
 
+BOOST_AUTO_TEST_CASE(Revision)
+{
+  Mesh mesh("MyMesh", 2, false, testing::nextMeshID());
+  Mesh other("OtherMesh", 2, false, testing::nextMeshID());
+  BOOST_TEST(mesh.getRevision() != other.getRevision());
+
+  auto revision = mesh.getRevision();
+  mesh.allocateDataValues();
+  BOOST_TEST(mesh.getRevision() == revision);
+
+  Vertex &v0 = mesh.createVertex(Eigen::Vector2d(0.0, 0.0));
+  BOOST_TEST(mesh.getRevision() != revision);
+  revision   = mesh.getRevision();
+  Vertex &v1 = mesh.createVertex(Eigen::Vector2d(1.0, 0.0));
+  BOOST_TEST(mesh.getRevision() != revision);
+  revision = mesh.getRevision();
+  mesh.createEdge(v0, v1);
+  BOOST_TEST(mesh.getRevision() != revision);
+  revision = mesh.getRevision();
+
+  v1.setCoords(Eigen::Vector2d(2.0, 0.0));
+  BOOST_TEST(mesh.getRevision() != revision);
+  revision = mesh.getRevision();
+  mesh.meshChanged(mesh);
+  BOOST_TEST(mesh.getRevision() != revision);
+  revision = mesh.getRevision();
+
+  mesh.clear();
+  BOOST_TEST(mesh.getRevision() != revision);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 BOOST_AUTO_TEST_SUITE_END() // Mesh
@@ -529,28 +529,103 @@ BOOST_AUTO_TEST_CASE(QueryWithBox)
   }
 }
 
+BOOST_AUTO_TEST_CASE(ParallelBulkLoading)
+{
+  // A wavy triangulated surface on a regular grid
+  PtrMesh   mesh(new precice::mesh::Mesh("MyMesh", 3, false, precice::testing::nextMeshID()));
+  const int n = 20;
+  for (int i = 0; i <= n; ++i) {
+    for (int j = 0; j <= n; ++j) {
+      mesh->createVertex(Eigen::Vector3d(i, j, std::sin(0.5 * i) * std::cos(0.3 * j)));
+    }
+  }
+  auto vertex = [&](int i, int j) -> Vertex & { return mesh->vertices()[i * (n + 1) + j]; };
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      auto &e0 = mesh->createEdge(vertex(i, j), vertex(i + 1, j));
+      auto &e1 = mesh->createEdge(vertex(i + 1, j), vertex(i + 1, j + 1));
+      auto &e2 = mesh->createEdge(vertex(i + 1, j + 1), vertex(i, j));
+      mesh->createTriangle(e0, e1, e2);
+    }
+  }
+
+  auto vertices  = rtree::getVertexRTree(mesh, 4);
+  auto edges     = rtree::getEdgeRTree(mesh, 4);
+  auto triangles = rtree::getTriangleRTree(mesh, 4);
+  BOOST_TEST(vertices->size() == mesh->vertices().size());
+  BOOST_TEST(edges->size() == mesh->edges().size());
+  BOOST_TEST(triangles->size() == mesh->triangles().size());
+
+  // The same boxes inserted one by one
+  PrimitiveRTree insertedTriangles;
+  for (size_t i = 0; i < mesh->triangles().size(); ++i) {
+    insertedTriangles.insert(std::make_pair(bg::return_envelope<AABB>(mesh->triangles()[i]), PrimitiveIndex{Primitive::Triangle, i}));
+  }
+
+  for (double x = -1.5; x < n + 1.5; x += 0.7) {
+    for (double y = -1.5; y < n + 1.5; y += 1.1) {
+      Eigen::VectorXd searchVector(Eigen::Vector3d(x, y, 0.25));
+
+      double vertexDistance = -1.0;
+      vertices->query(bgi::nearest(searchVector, 1), boost::make_function_output_iterator([&](size_t i) {
+                        vertexDistance = bg::distance(searchVector, mesh->vertices()[i]);
+                      }));
+      double expectedVertexDistance = std::numeric_limits<double>::max();
+      for (const auto &v : mesh->vertices()) {
+        expectedVertexDistance = std::min(expectedVertexDistance, bg::distance(searchVector, v));
+      }
+      BOOST_TEST(vertexDistance == expectedVertexDistance);
+
+      // Ties are resolved differently, hence we compare the distances of the matches
+      double edgeDistance = -1.0;
+      edges->query(bgi::nearest(searchVector, 1), boost::make_function_output_iterator([&](size_t i) {
+                     edgeDistance = bg::distance(searchVector, mesh->edges()[i]);
+                   }));
+      double expectedEdgeDistance = std::numeric_limits<double>::max();
+      for (const auto &e : mesh->edges()) {
+        expectedEdgeDistance = std::min(expectedEdgeDistance, bg::distance(searchVector, e));
+      }
+      BOOST_TEST(edgeDistance == expectedEdgeDistance);
+
+      double triangleDistance = -1.0, expectedTriangleDistance = -1.0;
+      triangles->query(bgi::nearest(searchVector, 1), boost::make_function_output_iterator([&](rtree::triangle_traits::IndexType const &val) {
+                         triangleDistance = bg::distance(searchVector, val.first);
+                       }));
+      insertedTriangles.query(bgi::nearest(searchVector, 1), boost::make_function_output_iterator([&](PrimitiveRTree::value_type const &val) {
+                                expectedTriangleDistance = bg::distance(searchVector, val.first);
+                              }));
+      BOOST_TEST(triangleDistance == expectedTriangleDistance);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(CacheClearing)
 {
   PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, false, precice::testing::nextMeshID()));
   mesh->createVertex(Eigen::Vector2d(0, 0));
 
-  // The Cache should clear whenever a mesh changes
+  // The Cache should be replaced whenever a mesh changes
   auto vTree1 = rtree::getVertexRTree(mesh);
   auto pTree1 = rtree::getPrimitiveRTree(mesh);
   BOOST_TEST(rtree::_cached_trees.size() == 1);
-  BOOST_TEST(rtree::_primitive_trees.size() == 1);
+  BOOST_TEST(rtree::getVertexRTree(mesh) == vTree1);
+  BOOST_TEST(rtree::getPrimitiveRTree(mesh) == pTree1);
   mesh->meshChanged(*mesh); // Emit signal, that mesh has changed
-  BOOST_TEST(rtree::_cached_trees.empty());
-  BOOST_TEST(rtree::_primitive_trees.empty());
-
-  // The Cache should clear whenever we destroy the Mesh
   auto vTree2 = rtree::getVertexRTree(mesh);
   auto pTree2 = rtree::getPrimitiveRTree(mesh);
+  BOOST_TEST(vTree2 != vTree1);
+  BOOST_TEST(pTree2 != pTree1);
   BOOST_TEST(rtree::_cached_trees.size() == 1);
-  BOOST_TEST(rtree::_primitive_trees.size() == 1);
+
+  // Adding primitives changes the mesh as well
+  mesh->createVertex(Eigen::Vector2d(1, 0));
+  auto vTree3 = rtree::getVertexRTree(mesh);
+  BOOST_TEST(vTree3 != vTree2);
+  BOOST_TEST(vTree3->size() == 2);
+
+  // The Cache should clear whenever we destroy the Mesh
   mesh.reset(); // Destroy mesh object, signal is emitted to clear cache
   BOOST_TEST(rtree::_cached_trees.empty());
-  BOOST_TEST(rtree::_primitive_trees.empty());
 }
 
 BOOST_AUTO_TEST_CASE(PrimitveIndexComparison)
@@ -1,4 +1,6 @@
 #include "partition/ReceivedPartition.hpp"
+#include <algorithm>
+#include <limits>
 #include <map>
 #include <vector>
 #include "com/CommunicateBoundingBox.hpp"
@@ -9,6 +11,7 @@
 #include "mesh/Edge.hpp"
 #include "mesh/Filter.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/RTree.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/Event.hpp"
@@ -22,6 +25,49 @@ extern bool syncMode;
 
 namespace partition {
 
+namespace {
+
+namespace bgi = boost::geometry::index;
+
+/// Remote bounding box together with the remote rank it belongs to
+using RemoteBox = std::pair<mesh::Box3d, int>;
+
+/// Returns false for empty bounding boxes, which are inverted in at least one dimension
+bool isValid(const mesh::Mesh::BoundingBox &bb)
+{
+  return std::all_of(bb.begin(), bb.end(), [](const std::pair<double, double> &bounds) {
+    return bounds.first <= bounds.second;
+  });
+}
+
+/// Checks whether a vertex lies within a bounding box, including its boundary
+bool isInside(const mesh::Vertex &vertex, const mesh::Mesh::BoundingBox &bb)
+{
+  for (size_t d = 0; d < bb.size(); d++) {
+    if (vertex.getCoords()[d] < bb[d].first or vertex.getCoords()[d] > bb[d].second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Converts a bounding box to a three-dimensional box, which is flat in z for 2D
+mesh::Box3d toBox(const mesh::Mesh::BoundingBox &bb)
+{
+  namespace bg = boost::geometry;
+  mesh::Box3d box;
+  bg::set<bg::min_corner, 0>(box, bb[0].first);
+  bg::set<bg::min_corner, 1>(box, bb[1].first);
+  bg::set<bg::min_corner, 2>(box, bb.size() == 3 ? bb[2].first : 0.0);
+
+  bg::set<bg::max_corner, 0>(box, bb[0].second);
+  bg::set<bg::max_corner, 1>(box, bb[1].second);
+  bg::set<bg::max_corner, 2>(box, bb.size() == 3 ? bb[2].second : 0.0);
+  return box;
+}
+
+} // namespace
+
 ReceivedPartition::ReceivedPartition(
     mesh::PtrMesh mesh, GeometricFilter geometricFilter, double safetyFactor)
     : Partition(mesh),
@@ -279,12 +325,13 @@ void ReceivedPartition::filterByBoundingBox()
       PRECICE_ASSERT(utils::MasterSlave::getSize() > 1);
 
       for (int rankSlave = 1; rankSlave < utils::MasterSlave::getSize(); rankSlave++) {
-        com::CommunicateMesh(utils::MasterSlave::_communication).receiveBoundingBox(_bb, rankSlave);
+        mesh::Mesh::BoundingBox slaveBB(_dimensions);
+        com::CommunicateMesh(utils::MasterSlave::_communication).receiveBoundingBox(slaveBB, rankSlave);
 
-        PRECICE_DEBUG("From slave " << rankSlave << ", bounding mesh: " << _bb[0].first
-                                    << ", " << _bb[0].second << " and " << _bb[1].first << ", " << _bb[1].second);
+        PRECICE_DEBUG("From slave " << rankSlave << ", bounding mesh: " << slaveBB[0].first
+                                    << ", " << slaveBB[0].second << " and " << slaveBB[1].first << ", " << slaveBB[1].second);
         mesh::Mesh slaveMesh("SlaveMesh", _dimensions, _mesh->isFlipNormals(), mesh::Mesh::MESH_ID_UNDEFINED);
-        mesh::filterMesh(slaveMesh, *_mesh, [&](const mesh::Vertex &v) { return isVertexInBB(v); });
+        mesh::filterMesh(slaveMesh, *_mesh, [&](const mesh::Vertex &v) { return isInside(v, slaveBB); });
         PRECICE_DEBUG("Send filtered mesh to slave: " << rankSlave);
         com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(slaveMesh, rankSlave);
       }
@@ -362,6 +409,8 @@ void ReceivedPartition::compareBoundingBoxes()
   if (not m2n().usesTwoLevelInitialization())
     return;
 
+  Event e("partition.compareBoundingBoxes." + _mesh->getName(), precice::syncMode);
+
   // receive and broadcast number of remote ranks
   int numberOfRemoteRanks = -1;
   if (utils::MasterSlave::isMaster()) {
@@ -394,30 +443,38 @@ void ReceivedPartition::compareBoundingBoxes()
   // prepare local bounding box
   prepareBoundingBox();
 
+  // find the overlapping remote bounding boxes with an R-tree instead of comparing against all of them
+  std::vector<RemoteBox> remoteBoxes;
+  remoteBoxes.reserve(remoteBBMap.size());
+  for (const auto &remoteBB : remoteBBMap) {
+    if (isValid(remoteBB.second)) {
+      remoteBoxes.emplace_back(toBox(remoteBB.second), remoteBB.first);
+    }
+  }
+  if (isValid(_bb)) {
+    const bgi::rtree<RemoteBox, mesh::RTreeParameters> remoteTree(remoteBoxes);
+    std::vector<RemoteBox>                             overlappingBoxes;
+    remoteTree.query(bgi::intersects(toBox(_bb)), std::back_inserter(overlappingBoxes));
+    for (const RemoteBox &remoteBox : overlappingBoxes) {
+      _mesh->getConnectedRanks().push_back(remoteBox.second);
+    }
+    std::sort(_mesh->getConnectedRanks().begin(), _mesh->getConnectedRanks().end());
+  }
+
   if (utils::MasterSlave::isMaster()) {                 // Master
     std::map<int, std::vector<int>> connectionMap;      //local ranks -> {remote ranks}
     std::vector<int>                connectedRanksList; // local ranks with any connection
 
-    // connected ranks for master
-    for (auto &remoteBB : remoteBBMap) {
-      if (overlapping(_bb, remoteBB.second)) {
-        _mesh->getConnectedRanks().push_back(remoteBB.first); //connected remote ranks for this rank
-      }
-    }
-    if (not _mesh->getConnectedRanks().empty()) {
-      connectionMap[0] = _mesh->getConnectedRanks();
-      connectedRanksList.push_back(0);
-    }
-
-    // receive connected ranks from slaves and add them to the connection map
-    for (int rank = 1; rank < utils::MasterSlave::getSize(); rank++) {
-      std::vector<int> slaveConnectedRanks;
-      int              connectedRanksSize = -1;
-      utils::MasterSlave::_communication->receive(connectedRanksSize, rank);
-      if (connectedRanksSize != 0) {
+    // gather connected ranks of all ranks and split them into the connection map
+    std::vector<int> gatheredRanks;
+    std::vector<int> counts;
+    utils::MasterSlave::_communication->gather(_mesh->getConnectedRanks(), gatheredRanks, counts);
+    auto begin = gatheredRanks.begin();
+    for (int rank = 0; rank < static_cast<int>(counts.size()); rank++) {
+      if (counts[rank] != 0) {
         connectedRanksList.push_back(rank);
-        utils::MasterSlave::_communication->receive(slaveConnectedRanks, rank);
-        connectionMap[rank] = slaveConnectedRanks;
+        connectionMap[rank].assign(begin, begin + counts[rank]);
+        begin += counts[rank];
       }
     }
 
@@ -430,34 +487,10 @@ void ReceivedPartition::compareBoundingBoxes()
     }
   } else {
     PRECICE_ASSERT(utils::MasterSlave::isSlave());
-
-    for (const auto &remoteBB : remoteBBMap) {
-      if (overlapping(_bb, remoteBB.second)) {
-        _mesh->getConnectedRanks().push_back(remoteBB.first);
-      }
-    }
-
-    // send connected ranks to master
-    utils::MasterSlave::_communication->send((int) _mesh->getConnectedRanks().size(), 0);
-    if (not _mesh->getConnectedRanks().empty()) {
-      utils::MasterSlave::_communication->send(_mesh->getConnectedRanks(), 0);
-    }
+    utils::MasterSlave::_communication->gather(_mesh->getConnectedRanks(), 0);
   }
 }
 
-bool ReceivedPartition::overlapping(mesh::Mesh::BoundingBox const &currentBB, mesh::Mesh::BoundingBox const &receivedBB)
-{
-  // Comparison is done for all dimensions and, of course, to have a proper overlap, each dimension must overlap.
-  // We need to check if first AND second is smaller than first of the other BB to prevent false negatives due to empty bounding boxes.
-  for (size_t i = 0; i < currentBB.size(); i++) {
-    if ((currentBB[i].first < receivedBB[i].first && currentBB[i].second < receivedBB[i].first) ||
-        (receivedBB[i].first < currentBB[i].first && receivedBB[i].second < currentBB[i].first)) {
-      return false;
-    }
-  }
-  return true;
-}
-
 void ReceivedPartition::prepareBoundingBox()
 {
   PRECICE_TRACE(_safetyFactor);
@@ -519,138 +552,90 @@ void ReceivedPartition::createOwnerInformation()
   PRECICE_TRACE();
   Event e("partition.createOwnerInformation." + _mesh->getName(), precice::syncMode);
 
-  if (utils::MasterSlave::isSlave()) {
-    int numberOfVertices = _mesh->vertices().size();
-    utils::MasterSlave::_communication->send(numberOfVertices, 0);
+  if (not utils::MasterSlave::isMaster() && not utils::MasterSlave::isSlave()) {
+    return;
+  }
 
-    if (numberOfVertices != 0) {
-      PRECICE_DEBUG("Tag vertices, number of vertices " << numberOfVertices);
-      std::vector<int> tags(numberOfVertices, -1);
-      std::vector<int> globalIDs(numberOfVertices, -1);
-      bool             atInterface = false;
-      for (int i = 0; i < numberOfVertices; i++) {
-        globalIDs[i] = _mesh->vertices()[i].getGlobalIndex();
-        if (_mesh->vertices()[i].isTagged()) {
-          tags[i]     = 1;
-          atInterface = true;
-        } else {
-          tags[i] = 0;
-        }
+  // Ownership is settled by lowest-rank-wins: a tagged vertex is owned by the
+  // lowest rank that tags it. Every rank only exchanges global IDs with the
+  // neighbor ranks whose boxes of tagged vertices overlap its own box.
+  const int size    = utils::MasterSlave::getSize();
+  const int rank    = utils::MasterSlave::getRank();
+  const int boxSize = 2 * _dimensions;
+
+  // Boxes of the tagged vertices of all ranks, every rank contributes its own one to the sum
+  std::vector<double> localBoxes(size * boxSize, 0.0);
+  for (int d = 0; d < _dimensions; d++) {
+    localBoxes[rank * boxSize + 2 * d]     = std::numeric_limits<double>::max();
+    localBoxes[rank * boxSize + 2 * d + 1] = std::numeric_limits<double>::lowest();
+  }
+  for (const mesh::Vertex &vertex : _mesh->vertices()) {
+    if (vertex.isTagged()) {
+      for (int d = 0; d < _dimensions; d++) {
+        localBoxes[rank * boxSize + 2 * d]     = std::min(localBoxes[rank * boxSize + 2 * d], vertex.getCoords()[d]);
+        localBoxes[rank * boxSize + 2 * d + 1] = std::max(localBoxes[rank * boxSize + 2 * d + 1], vertex.getCoords()[d]);
       }
-      PRECICE_DEBUG("My tags: " << tags);
-      PRECICE_DEBUG("My global IDs: " << globalIDs);
-      PRECICE_DEBUG("Send tags and global IDs");
-      utils::MasterSlave::_communication->send(tags, 0);
-      utils::MasterSlave::_communication->send(globalIDs, 0);
-      utils::MasterSlave::_communication->send(atInterface, 0);
-
-      PRECICE_DEBUG("Receive owner information");
-      std::vector<int> ownerVec(numberOfVertices, -1);
-      utils::MasterSlave::_communication->receive(ownerVec, 0);
-      PRECICE_DEBUG("My owner information: " << ownerVec);
-      setOwnerInformation(ownerVec);
     }
   }
+  std::vector<double> boxes(size * boxSize);
+  utils::MasterSlave::allreduceSum(localBoxes.data(), boxes.data(), size * boxSize);
 
-  else if (utils::MasterSlave::isMaster()) {
-    // To temporary store which vertices already have an owner
-    std::vector<int> globalOwnerVec(_mesh->getGlobalNumberOfVertices(), 0);
-    // The same per rank
-    std::vector<std::vector<int>> slaveOwnerVecs(utils::MasterSlave::getSize());
-    // Global IDs per rank
-    std::vector<std::vector<int>> slaveGlobalIDs(utils::MasterSlave::getSize());
-    // Tag information per rank
-    std::vector<std::vector<int>> slaveTags(utils::MasterSlave::getSize());
-
-    // Fill master data
-    PRECICE_DEBUG("Tag master vertices");
-    bool masterAtInterface = false;
-    slaveOwnerVecs[0].resize(_mesh->vertices().size());
-    slaveGlobalIDs[0].resize(_mesh->vertices().size());
-    slaveTags[0].resize(_mesh->vertices().size());
-    for (size_t i = 0; i < _mesh->vertices().size(); i++) {
-      slaveGlobalIDs[0][i] = _mesh->vertices()[i].getGlobalIndex();
-      if (_mesh->vertices()[i].isTagged()) {
-        masterAtInterface = true;
-        slaveTags[0][i]   = 1;
-      } else {
-        slaveTags[0][i] = 0;
-      }
+  auto boxOf = [&](int boxRank) {
+    mesh::Mesh::BoundingBox bb(_dimensions);
+    for (int d = 0; d < _dimensions; d++) {
+      bb[d] = std::make_pair(boxes[boxRank * boxSize + 2 * d], boxes[boxRank * boxSize + 2 * d + 1]);
     }
-    PRECICE_DEBUG("My tags: " << slaveTags[0]);
-
-    // receive slave data
-    int ranksAtInterface = 0;
-    if (masterAtInterface)
-      ranksAtInterface++;
-
-    for (int rank = 1; rank < utils::MasterSlave::getSize(); rank++) {
-      int localNumberOfVertices = -1;
-      utils::MasterSlave::_communication->receive(localNumberOfVertices, rank);
-      PRECICE_DEBUG("Rank " << rank << " has " << localNumberOfVertices << " vertices.");
-      slaveOwnerVecs[rank].resize(localNumberOfVertices, 0);
-
-      if (localNumberOfVertices != 0) {
-        PRECICE_DEBUG("Receive tags from slave rank " << rank);
-        utils::MasterSlave::_communication->receive(slaveTags[rank], rank);
-        utils::MasterSlave::_communication->receive(slaveGlobalIDs[rank], rank);
-        PRECICE_DEBUG("Rank " << rank << " has tags " << slaveTags[rank]);
-        PRECICE_DEBUG("Rank " << rank << " has global IDs " << slaveGlobalIDs[rank]);
-        bool atInterface = false;
-        utils::MasterSlave::_communication->receive(atInterface, rank);
-        if (atInterface)
-          ranksAtInterface++;
+    return bb;
+  };
+
+  // Send the global IDs of tagged vertices to every higher neighbor rank that could tag them as well
+  std::vector<std::vector<int>> sendIDs(size);
+  const mesh::Mesh::BoundingBox ownBB = boxOf(rank);
+  if (isValid(ownBB)) {
+    const mesh::Box3d ownBox = toBox(ownBB);
+    for (int neighbor = rank + 1; neighbor < size; neighbor++) {
+      const mesh::Mesh::BoundingBox neighborBB = boxOf(neighbor);
+      if (not isValid(neighborBB) || not boost::geometry::intersects(ownBox, toBox(neighborBB))) {
+        continue;
       }
-    }
-
-    // Decide upon owners,
-    PRECICE_DEBUG("Decide owners, first round by rough load balancing");
-    int localGuess = _mesh->getGlobalNumberOfVertices() / ranksAtInterface; // Guess for a decent load balancing
-    // First round: every slave gets localGuess vertices
-    for (int rank = 0; rank < utils::MasterSlave::getSize(); rank++) {
-      int counter = 0;
-      for (size_t i = 0; i < slaveOwnerVecs[rank].size(); i++) {
-        // Vertex has no owner yet and rank could be owner
-        if (globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i] == 1) {
-          slaveOwnerVecs[rank][i]                 = 1; // Now rank is owner
-          globalOwnerVec[slaveGlobalIDs[rank][i]] = 1; // Vertex now has owner
-          counter++;
-          if (counter == localGuess)
-            break;
+      for (const mesh::Vertex &vertex : _mesh->vertices()) {
+        if (vertex.isTagged() && isInside(vertex, neighborBB)) {
+          sendIDs[neighbor].push_back(vertex.getGlobalIndex());
         }
       }
     }
+  }
+  PRECICE_DEBUG("Exchange tagged global IDs with neighbor ranks");
+  std::vector<std::vector<int>> receivedIDs;
+  if (utils::MasterSlave::isMaster()) {
+    utils::MasterSlave::_communication->allToAll(sendIDs, receivedIDs);
+  } else {
+    utils::MasterSlave::_communication->allToAll(sendIDs, receivedIDs, 0);
+  }
 
-    // Second round: distribute all other vertices in a greedy way
-    PRECICE_DEBUG("Decide owners, second round in greedy way");
-    for (int rank = 0; rank < utils::MasterSlave::getSize(); rank++) {
-      for (size_t i = 0; i < slaveOwnerVecs[rank].size(); i++) {
-        if (globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i] == 1) {
-          slaveOwnerVecs[rank][i]                 = 1;
-          globalOwnerVec[slaveGlobalIDs[rank][i]] = rank + 1;
-        }
-      }
+  // Vertices tagged by a lower rank are owned by that rank
+  std::vector<int> lowerRankIDs;
+  for (const auto &ids : receivedIDs) {
+    lowerRankIDs.insert(lowerRankIDs.end(), ids.begin(), ids.end());
+  }
+  std::sort(lowerRankIDs.begin(), lowerRankIDs.end());
+
+  std::vector<int> ownerVec(_mesh->vertices().size(), 0);
+  int              ownedVertices = 0;
+  for (size_t i = 0; i < _mesh->vertices().size(); i++) {
+    const mesh::Vertex &vertex = _mesh->vertices()[i];
+    if (vertex.isTagged() && not std::binary_search(lowerRankIDs.begin(), lowerRankIDs.end(), vertex.getGlobalIndex())) {
+      ownerVec[i] = 1;
+      ownedVertices++;
     }
+  }
+  PRECICE_DEBUG("My owner information: " << ownerVec);
+  setOwnerInformation(ownerVec);
 
-    // Send information back to slaves
-    for (int rank = 1; rank < utils::MasterSlave::getSize(); rank++) {
-      if (not slaveTags[rank].empty())
-        PRECICE_DEBUG("Send owner information to slave rank " << rank);
-      utils::MasterSlave::_communication->send(slaveOwnerVecs[rank], rank);
-    }
-    // Master data
-    PRECICE_DEBUG("My owner information: " << slaveOwnerVecs[0]);
-    setOwnerInformation(slaveOwnerVecs[0]);
-
-#ifndef NDEBUG
-    for (size_t i = 0; i < globalOwnerVec.size(); i++) {
-      if (globalOwnerVec[i] == 0) {
-        PRECICE_DEBUG("The Vertex with global index " << i << " of mesh: " << _mesh->getName()
-                                                      << " was completely filtered out, since it has no influence on any mapping.");
-      }
-    }
-#endif
-    auto filteredVertices = std::count(globalOwnerVec.begin(), globalOwnerVec.end(), 0);
+  int globalOwnedVertices = 0;
+  utils::MasterSlave::reduceSum(ownedVertices, globalOwnedVertices, 1);
+  if (utils::MasterSlave::isMaster()) {
+    const int filteredVertices = _mesh->getGlobalNumberOfVertices() - globalOwnedVertices;
     if (filteredVertices)
       PRECICE_WARN(filteredVertices << " of " << _mesh->getGlobalNumberOfVertices()
                                     << " vertices of mesh " << _mesh->getName() << " have been filtered out "
@@ -49,9 +49,6 @@ private:
   /// Sets _bb to the union with the mesh from fromMapping resp. toMapping, also enlage by _safetyFactor
   void prepareBoundingBox();
 
-  /// Checks whether two bounding boxes are overlapping
-  bool overlapping(mesh::Mesh::BoundingBox const &currentBB, mesh::Mesh::BoundingBox const &receivedBB);
-
   /// Checks if vertex in contained in _bb
   bool isVertexInBB(const mesh::Vertex &vertex);
 
@@ -62,6 +59,7 @@ private:
    */
   bool areProvidedMeshesEmpty() const;
 
+  /// Decides which rank owns each tagged vertex, the lowest rank which tags a vertex owns it
   void createOwnerInformation();
 
   /// Helper function for 'createOwnerFunction' to set local owner information
@@ -307,6 +307,62 @@ BOOST_AUTO_TEST_CASE(RePartitionNNBroadcastFilter2D, *testing::OnSize(4))
   tearDownParallelEnvironment();
 }
 
+BOOST_AUTO_TEST_CASE(RePartitionFilterOnMasterUsesOwnBoundingBox2D, *testing::OnSize(4))
+{
+  com::PtrCommunication participantCom =
+      com::PtrCommunication(new com::MPIDirectCommunication());
+  m2n::DistributedComFactory::SharedPointer distrFactory = m2n::DistributedComFactory::SharedPointer(
+      new m2n::GatherScatterComFactory(participantCom));
+  m2n::PtrM2N m2n = m2n::PtrM2N(new m2n::M2N(participantCom, distrFactory));
+
+  setupParallelEnvironment(m2n);
+
+  int  dimensions  = 2;
+  bool flipNormals = false;
+
+  if (utils::Parallel::getProcessRank() == 0) { //SOLIDZ
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, flipNormals, testing::nextMeshID()));
+    createSolidzMesh2D(pSolidzMesh);
+    ProvidedPartition part(pSolidzMesh);
+    part.addM2N(m2n);
+    part.communicate();
+  } else {
+    mesh::PtrMesh pNastinMesh(new mesh::Mesh("NastinMesh", dimensions, flipNormals, testing::nextMeshID()));
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, flipNormals, testing::nextMeshID()));
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions));
+    mapping::PtrMapping boundingToMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSERVATIVE, dimensions));
+    boundingFromMapping->setMeshes(pSolidzMesh, pNastinMesh);
+    boundingToMapping->setMeshes(pNastinMesh, pSolidzMesh);
+
+    createNastinMesh2D(pNastinMesh);
+    pNastinMesh->computeState();
+    pNastinMesh->computeBoundingBox();
+
+    double safetyFactor = 0.1;
+
+    ReceivedPartition part(pSolidzMesh, ReceivedPartition::ON_MASTER, safetyFactor);
+    part.addM2N(m2n);
+    part.setFromMapping(boundingFromMapping);
+    part.setToMapping(boundingToMapping);
+    part.communicate();
+    part.compute();
+
+    // the master must filter its remaining mesh by its own bounding box, not by the one of the last slave
+    if (utils::Parallel::getProcessRank() == 1) { //Master
+      BOOST_TEST(pSolidzMesh->vertices().size() == 2);
+      for (const mesh::Vertex &vertex : pSolidzMesh->vertices()) {
+        BOOST_TEST(vertex.getCoords()(1) < 2.2);
+        BOOST_TEST(vertex.getGlobalIndex() < 2);
+      }
+    }
+  }
+
+  tearDownParallelEnvironment();
+}
+
 BOOST_AUTO_TEST_CASE(RePartitionNNDoubleNode2D, *testing::OnSize(4))
 {
   com::PtrCommunication participantCom =
@@ -879,7 +935,7 @@ BOOST_AUTO_TEST_CASE(TestRepartitionAndDistribution2D,
     BOOST_TEST(pMesh->vertices()[0].getGlobalIndex() == 0);
     BOOST_TEST(pMesh->vertices()[1].getGlobalIndex() == 1);
     BOOST_TEST(pMesh->vertices()[0].isOwner() == true);
-    BOOST_TEST(pMesh->vertices()[1].isOwner() == false);
+    BOOST_TEST(pMesh->vertices()[1].isOwner() == true);
   } else if (utils::Parallel::getProcessRank() == 2) { //Slave2
     BOOST_TEST(pMesh->getVertexOffsets().size() == 4);
     BOOST_TEST(pMesh->getVertexOffsets()[0] == 0);
@@ -888,7 +944,8 @@ BOOST_AUTO_TEST_CASE(TestRepartitionAndDistribution2D,
     BOOST_TEST(pMesh->getVertexOffsets()[3] == 3);
     BOOST_TEST(pMesh->vertices().size() == 1);
     BOOST_TEST(pMesh->vertices()[0].getGlobalIndex() == 1);
-    BOOST_TEST(pMesh->vertices()[0].isOwner() == true);
+    // The vertex is shared with rank 1, which owns it as the lower rank
+    BOOST_TEST(pMesh->vertices()[0].isOwner() == false);
   } else if (utils::Parallel::getProcessRank() == 3) { //Slave3
     BOOST_TEST(pMesh->getVertexOffsets().size() == 4);
     BOOST_TEST(pMesh->getVertexOffsets()[0] == 0);
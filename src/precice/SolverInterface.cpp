@@ -298,6 +298,30 @@ void SolverInterface::readScalarData(
   return _impl->readScalarData(dataID, valueIndex, value);
 }
 
+void SolverInterface::writeAllData(
+    int           dataID,
+    const double *values)
+{
+  _impl->writeAllData(dataID, values);
+}
+
+void SolverInterface::readAllData(
+    int     dataID,
+    double *values) const
+{
+  _impl->readAllData(dataID, values);
+}
+
+double *SolverInterface::getWriteDataBuffer(int dataID)
+{
+  return _impl->getWriteDataBuffer(dataID);
+}
+
+const double *SolverInterface::getReadDataBuffer(int dataID) const
+{
+  return _impl->getReadDataBuffer(dataID);
+}
+
 std::string getVersionInformation()
 {
   return {precice::versionInformation};
@@ -770,6 +770,79 @@ public:
 
   ///@}
 
+  /// @name Direct Access to Data
+  ///@{
+
+  /**
+   * @brief Writes data of all vertices of the mesh.
+   *
+   * This function writes the values of all vertices to a dataID, ordered by
+   * the vertex indices. In contrast to the block functions, no indices are
+   * required. Scalar and vector data are both supported.
+   *
+   * The format of values is the one of writeBlockScalarData() or
+   * writeBlockVectorData(), respectively, for the indices 0 to n-1.
+   *
+   * @param[in] dataID ID to write to.
+   * @param[in] values pointer to the values.
+   *
+   * @pre count of available elements at values matches getMeshVertexSize() times the dimension of the data
+   * @pre initialize() has been called
+   */
+  void writeAllData(
+      int           dataID,
+      const double *values);
+
+  /**
+   * @brief Reads data of all vertices of the mesh.
+   *
+   * This function reads the values of all vertices from a dataID, ordered by
+   * the vertex indices. Scalar and vector data are both supported.
+   *
+   * @param[in] dataID ID to read from.
+   * @param[out] values pointer to read destination.
+   *
+   * @pre count of available elements at values matches getMeshVertexSize() times the dimension of the data
+   * @pre initialize() has been called
+   *
+   * @post values contain the read data in the format of writeAllData().
+   */
+  void readAllData(
+      int     dataID,
+      double *values) const;
+
+  /**
+   * @brief Returns the internal buffer of write data to fill it in place.
+   *
+   * The buffer holds getMeshVertexSize() times the dimension of the data values,
+   * in the format of writeAllData(). Writing to it is equivalent to writing data.
+   *
+   * @param[in] dataID ID of the write data.
+   *
+   * @pre initialize() has been called
+   * @pre the mesh of the data has not been reset since initialize() or advance()
+   *
+   * @returns a pointer to the data values, which is valid until the next call of advance().
+   */
+  double *getWriteDataBuffer(int dataID);
+
+  /**
+   * @brief Returns the internal buffer of read data to read from it in place.
+   *
+   * The buffer holds getMeshVertexSize() times the dimension of the data values,
+   * in the format of readAllData().
+   *
+   * @param[in] dataID ID of the read data.
+   *
+   * @pre initialize() has been called
+   * @pre the mesh of the data has not been reset since initialize() or advance()
+   *
+   * @returns a pointer to the data values, which is valid until the next call of advance().
+   */
+  const double *getReadDataBuffer(int dataID) const;
+
+  ///@}
+
   /// Disable copy construction
   SolverInterface(const SolverInterface &copy) = delete;
 
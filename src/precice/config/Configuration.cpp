@@ -1,4 +1,6 @@
 #include "Configuration.hpp"
+#include <limits>
+#include "utils/EventUtils.hpp"
 #include "xml/XMLAttribute.hpp"
 
 namespace precice {
@@ -24,6 +26,11 @@ Configuration::Configuration()
   auto attrSyncMode = xml::makeXMLAttribute("sync-mode", false)
                           .setDocumentation("sync-mode enabled additional inter- and intra-participant synchronizations");
   _tag.addAttribute(attrSyncMode);
+
+  auto attrTimelineCapacity = xml::makeXMLAttribute("event-timeline-capacity", -1)
+                                  .setDocumentation("Maximum number of state changes kept per event for the timeline of the event report. "
+                                                    "Only the latest ones are kept, 0 disables the timeline, and a negative value keeps all.");
+  _tag.addAttribute(attrTimelineCapacity);
 }
 
 xml::XMLTag &Configuration::getXMLTag()
@@ -36,6 +43,9 @@ void Configuration::xmlTagCallback(const xml::ConfigurationContext &context, xml
   PRECICE_TRACE(tag.getName());
   if (tag.getName() == "precice-configuration") {
     precice::syncMode = tag.getBooleanAttributeValue("sync-mode");
+    const int timelineCapacity = tag.getIntAttributeValue("event-timeline-capacity");
+    utils::EventRegistry::instance().setTimelineCapacity(
+        timelineCapacity < 0 ? std::numeric_limits<std::size_t>::max() : static_cast<std::size_t>(timelineCapacity));
   }
 }
 
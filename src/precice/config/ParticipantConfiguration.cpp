@@ -482,7 +482,7 @@ void ParticipantConfiguration::finishParticipantConfiguration(
     io::PtrExport exporter;
     if (exportContext.type == VALUE_VTK) {
       if (context.size > 1) {
-        exporter = io::PtrExport(new io::ExportVTKXML(exportContext.plotNormals));
+        exporter = io::PtrExport(new io::ExportVTKXML(exportContext.plotNormals, exportContext.binary, exportContext.asynchronous));
       } else {
         exporter = io::PtrExport(new io::ExportVTK(exportContext.plotNormals));
       }
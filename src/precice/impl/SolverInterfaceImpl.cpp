@@ -32,6 +32,7 @@
 #include "utils/algorithm.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <utility>
 
 #include "logging/LogConfiguration.hpp"
@@ -417,6 +418,9 @@ void SolverInterfaceImpl::finalize()
       }
     }
   }
+  for (const io::ExportContext &context : _accessor->exportContexts()) {
+    context.exporter->flush();
+  }
   // Apply some final ping-pong to synch solver that run e.g. with a uni-directional coupling only
   // afterwards close connections
   PRECICE_DEBUG("Synchronize participants and close communication channels");
@@ -1071,6 +1075,62 @@ void SolverInterfaceImpl::readScalarData(
   PRECICE_DEBUG("Read value = " << value);
 }
 
+void SolverInterfaceImpl::writeAllData(
+    int           fromDataID,
+    const double *values)
+{
+  PRECICE_TRACE(fromDataID);
+  PRECICE_VALIDATE_DATA_ID(fromDataID);
+  PRECICE_REQUIRE_DATA_WRITE(fromDataID);
+  DataContext &context = _accessor->dataContext(fromDataID);
+  PRECICE_ASSERT(context.toData.get() != nullptr);
+  auto &valuesInternal = context.fromData->values();
+  if (valuesInternal.size() == 0)
+    return;
+  PRECICE_ASSERT(values != nullptr);
+  valuesInternal = Eigen::Map<const Eigen::VectorXd>(values, valuesInternal.size());
+}
+
+void SolverInterfaceImpl::readAllData(
+    int     toDataID,
+    double *values) const
+{
+  PRECICE_TRACE(toDataID);
+  PRECICE_VALIDATE_DATA_ID(toDataID);
+  PRECICE_REQUIRE_DATA_READ(toDataID);
+  DataContext &context = _accessor->dataContext(toDataID);
+  PRECICE_ASSERT(context.fromData.get() != nullptr);
+  const auto &valuesInternal = context.toData->values();
+  if (valuesInternal.size() == 0)
+    return;
+  PRECICE_ASSERT(values != nullptr);
+  Eigen::Map<Eigen::VectorXd>(values, valuesInternal.size()) = valuesInternal;
+}
+
+double *SolverInterfaceImpl::getWriteDataBuffer(int fromDataID)
+{
+  PRECICE_TRACE(fromDataID);
+  PRECICE_VALIDATE_DATA_ID(fromDataID);
+  PRECICE_REQUIRE_DATA_WRITE(fromDataID);
+  DataContext &context = _accessor->dataContext(fromDataID);
+  PRECICE_CHECK(_meshLock.check(context.mesh->getID()),
+                "Direct access to data \"" << context.fromData->getName() << "\" requires the mesh \""
+                                            << context.mesh->getName() << "\" to be locked. Call initialize() first and do not reset the mesh.");
+  return context.fromData->values().data();
+}
+
+const double *SolverInterfaceImpl::getReadDataBuffer(int toDataID) const
+{
+  PRECICE_TRACE(toDataID);
+  PRECICE_VALIDATE_DATA_ID(toDataID);
+  PRECICE_REQUIRE_DATA_READ(toDataID);
+  DataContext &context = _accessor->dataContext(toDataID);
+  PRECICE_CHECK(_meshLock.check(context.mesh->getID()),
+                "Direct access to data \"" << context.toData->getName() << "\" requires the mesh \""
+                                            << context.mesh->getName() << "\" to be locked. Call initialize() first and do not reset the mesh.");
+  return context.toData->values().data();
+}
+
 void SolverInterfaceImpl::exportMesh(
     const std::string &filenameSuffix,
     int                exportType) const
@@ -1263,6 +1323,7 @@ void SolverInterfaceImpl::mapWrittenData()
   }
 
   // Map data
+  std::vector<impl::DataContext *> dataToMap;
   for (impl::DataContext &context : _accessor->writeDataContexts()) {
     timing          = context.mappingContext.timing;
     bool hasMapping = context.mappingContext.mapping.get() != nullptr;
@@ -1270,16 +1331,12 @@ void SolverInterfaceImpl::mapWrittenData()
     rightTime |= timing == MappingConfiguration::INITIAL;
     bool hasMapped = context.mappingContext.hasMappedData;
     if (hasMapping && rightTime && (not hasMapped)) {
-      int inDataID  = context.fromData->getID();
-      int outDataID = context.toData->getID();
       PRECICE_DEBUG("Map data \"" << context.fromData->getName()
                                   << "\" from mesh \"" << context.mesh->getName() << "\"");
-      context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
-      PRECICE_DEBUG("Map from dataID " << inDataID << " to dataID: " << outDataID);
-      context.mappingContext.mapping->map(inDataID, outDataID);
-      PRECICE_DEBUG("Mapped values = " << utils::previewRange(3, context.toData->values()));
+      dataToMap.push_back(&context);
     }
   }
+  mapDataContexts(dataToMap);
 
   // Clear non-stationary, non-incremental mappings
   for (impl::MappingContext &context : _accessor->writeMappingContexts()) {
@@ -1313,6 +1370,7 @@ void SolverInterfaceImpl::mapReadData()
   }
 
   // Map data
+  std::vector<impl::DataContext *> dataToMap;
   for (impl::DataContext &context : _accessor->readDataContexts()) {
     timing      = context.mappingContext.timing;
     bool mapNow = timing == mapping::MappingConfiguration::ON_ADVANCE;
@@ -1320,15 +1378,12 @@ void SolverInterfaceImpl::mapReadData()
     bool hasMapping = context.mappingContext.mapping.get() != nullptr;
     bool hasMapped  = context.mappingContext.hasMappedData;
     if (mapNow && hasMapping && (not hasMapped)) {
-      int inDataID             = context.fromData->getID();
-      int outDataID            = context.toData->getID();
-      context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
       PRECICE_DEBUG("Map read data \"" << context.fromData->getName()
                                        << "\" to mesh \"" << context.mesh->getName() << "\"");
-      context.mappingContext.mapping->map(inDataID, outDataID);
-      PRECICE_DEBUG("Mapped values = " << utils::previewRange(3, context.toData->values()));
+      dataToMap.push_back(&context);
     }
   }
+  mapDataContexts(dataToMap);
   // Clear non-initial, non-incremental mappings
   for (impl::MappingContext &context : _accessor->readMappingContexts()) {
     bool isStationary = context.timing == mapping::MappingConfiguration::INITIAL;
@@ -1339,6 +1394,38 @@ void SolverInterfaceImpl::mapReadData()
   }
 }
 
+void SolverInterfaceImpl::mapDataContexts(const std::vector<DataContext *> &contexts)
+{
+  PRECICE_TRACE(contexts.size());
+  using Batch = std::pair<mapping::PtrMapping, mapping::Mapping::DataIDPairs>;
+
+  // Group the data by mapping, preserving the configured order
+  std::vector<Batch> batches;
+  for (DataContext *context : contexts) {
+    const mapping::PtrMapping &mappingPtr = context->mappingContext.mapping;
+    auto                       batch      = std::find_if(batches.begin(), batches.end(), [&mappingPtr](const Batch &b) {
+      return b.first == mappingPtr;
+    });
+    if (batch == batches.end()) {
+      batches.emplace_back(mappingPtr, mapping::Mapping::DataIDPairs{});
+      batch = std::prev(batches.end());
+    }
+    int inDataID              = context->fromData->getID();
+    int outDataID             = context->toData->getID();
+    context->toData->values() = Eigen::VectorXd::Zero(context->toData->values().size());
+    PRECICE_DEBUG("Map from dataID " << inDataID << " to dataID: " << outDataID);
+    batch->second.emplace_back(inDataID, outDataID);
+  }
+
+  for (auto &batch : batches) {
+    batch.first->mapBatch(batch.second);
+  }
+
+  for (DataContext *context : contexts) {
+    PRECICE_DEBUG("Mapped values = " << utils::previewRange(3, context->toData->values()));
+  }
+}
+
 void SolverInterfaceImpl::performDataActions(
     const std::set<action::Action::Timing> &timings,
     double                                  time,
@@ -453,6 +453,32 @@ public:
       int     valueIndex,
       double &value) const;
 
+  /**
+   * @brief Writes the values of all vertices, ordered by vertex index.
+   *
+   * @param[in] fromDataID ID of the data to be written.
+   * @param[in] values Values of the data to be written, the size of the mesh times the data dimension.
+   */
+  void writeAllData(
+      int           fromDataID,
+      const double *values);
+
+  /**
+   * @brief Reads the values of all vertices, ordered by vertex index.
+   *
+   * @param[in] toDataID ID of the data to be read.
+   * @param[out] values Read data values, the size of the mesh times the data dimension.
+   */
+  void readAllData(
+      int     toDataID,
+      double *values) const;
+
+  /// Returns the values of the write data, valid until the next advance() or mesh reset.
+  double *getWriteDataBuffer(int fromDataID);
+
+  /// Returns the values of the read data, valid until the next advance() or mesh reset.
+  const double *getReadDataBuffer(int toDataID) const;
+
   /**
    * @brief Sets the location for all output of preCICE.
    *
@@ -587,6 +613,9 @@ private:
   /// Computes, performs, and resets all suitable read mappings.
   void mapReadData();
 
+  /// Maps the data of the given contexts, data sharing a mapping is mapped in one batch.
+  void mapDataContexts(const std::vector<DataContext *> &contexts);
+
   /**
    * @brief Performs all data actions with given timing.
    *
@@ -1,14 +1,15 @@
 #include "WatchPoint.hpp"
+#include <boost/function_output_iterator.hpp>
 #include <limits>
 #include "com/Communication.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/RTree.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "query/FindClosestEdge.hpp"
 #include "query/FindClosestTriangle.hpp"
-#include "query/FindClosestVertex.hpp"
 #include "utils/MasterSlave.hpp"
 
 namespace precice {
@@ -35,12 +36,15 @@ const mesh::PtrMesh &WatchPoint::mesh() const
 void WatchPoint::initialize()
 {
   PRECICE_TRACE();
-  // Find closest vertex
+  // Find closest vertex, using the index tree shared with the mappings
   if (_mesh->vertices().size() > 0) {
-    query::FindClosestVertex findVertex(_point);
-    findVertex(*_mesh);
-    _vertices.push_back(&findVertex.getClosestVertex());
-    _shortestDistance = findVertex.getEuclidianDistance();
+    auto tree = mesh::rtree::getVertexRTree(_mesh);
+    tree->query(boost::geometry::index::nearest(_point, 1),
+                boost::make_function_output_iterator([&](size_t match) {
+                  mesh::Vertex &vertex = _mesh->vertices()[match];
+                  _vertices.push_back(&vertex);
+                  _shortestDistance = boost::geometry::distance(_point, vertex);
+                }));
     _weights.push_back(1.0);
   }
 
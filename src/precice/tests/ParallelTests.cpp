@@ -241,7 +241,7 @@ BOOST_AUTO_TEST_CASE(TestQN, *testing::OnSize(4))
   configs[1] = _pathToTests + "QN2.xml";
   configs[2] = _pathToTests + "QN3.xml";
 
-  int correctIterations[3] = {29, 17, 15};
+  int correctIterations[3] = {17, 17, 15};
 
   std::string solverName, meshName, writeDataName, readDataName;
   int         rank, size;
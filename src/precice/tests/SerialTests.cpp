@@ -7,8 +7,10 @@
 #include "precice/impl/MeshContext.hpp"
 #include "precice/impl/Participant.hpp"
 #include "precice/impl/SolverInterfaceImpl.hpp"
+#include "utils/EventUtils.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/Parallel.hpp"
+#include "xml/XMLTag.hpp"
 
 using namespace precice;
 
@@ -72,6 +74,18 @@ BOOST_AUTO_TEST_CASE(TestConfiguration)
   BOOST_TEST(comsol->_usedMeshContexts.size() == 1);
 }
 
+/// Test reading of the attribute event-timeline-capacity.
+BOOST_AUTO_TEST_CASE(TestEventTimelineCapacity, *testing::OnMaster())
+{
+  config::Configuration config;
+  xml::configure(config.getXMLTag(), xml::ConfigurationContext{"SolverOne", 0, 1}, _pathToTests + "event-timeline-capacity.xml");
+  BOOST_TEST(not utils::EventRegistry::instance().hasTimeline());
+
+  // Restore the default, which keeps all state changes
+  utils::EventRegistry::instance().setTimelineCapacity(std::numeric_limits<std::size_t>::max());
+  BOOST_TEST(utils::EventRegistry::instance().hasTimeline());
+}
+
 /// Test to run simple "do nothing" coupling between two solvers.
 BOOST_AUTO_TEST_CASE(TestExplicit,
                      *testing::MinRanks(2) * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
@@ -462,6 +476,139 @@ BOOST_AUTO_TEST_CASE(testExplicitWithBlockDataExchange,
   }
 }
 
+BOOST_AUTO_TEST_CASE(testExplicitWithDirectDataAccess,
+                     *testing::MinRanks(2) * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  double counter = 0.0;
+  using Eigen::Vector3d;
+
+  if (utils::Parallel::getProcessRank() == 0) {
+    SolverInterface cplInterface("SolverOne", _pathToTests + "explicit-mpi-single-non-inc.xml", 0, 1);
+
+    int             meshOneID      = cplInterface.getMeshID("MeshOne");
+    double          maxDt          = cplInterface.initialize();
+    int             forcesID       = cplInterface.getDataID("Forces", meshOneID);
+    int             pressuresID    = cplInterface.getDataID("Pressures", meshOneID);
+    int             velocitiesID   = cplInterface.getDataID("Velocities", meshOneID);
+    int             temperaturesID = cplInterface.getDataID("Temperatures", meshOneID);
+    auto &          vertices       = impl(cplInterface).mesh("Test-Square").vertices();
+    int             size           = vertices.size();
+    Eigen::VectorXd writePositions(size * 3);
+    Eigen::VectorXd getWritePositions(size * 3);
+    Eigen::VectorXd forces(size * 3);
+    Eigen::VectorXd pressures(size);
+    Eigen::VectorXi writeIDs(size);
+    Eigen::VectorXi getWriteIDs(size);
+    Eigen::VectorXd readPositions(size * 3);
+    Eigen::VectorXd getReadPositions(size * 3);
+    Eigen::VectorXd velocities(size * 3);
+    Eigen::VectorXd temperatures(size);
+    Eigen::VectorXd expectedVelocities(size * 3);
+    Eigen::VectorXd expectedTemperatures(size);
+    Eigen::VectorXi readIDs(size);
+    Eigen::VectorXi getReadIDs(size);
+
+    while (cplInterface.isCouplingOngoing()) {
+      impl(cplInterface).resetMesh(meshOneID);
+      for (auto &vertex : vertices) {
+        for (int dim = 0; dim < 3; dim++) {
+          writePositions[vertex.getID() * 3 + dim] = vertex.getCoords()[dim];
+        }
+      }
+      cplInterface.setMeshVertices(meshOneID, size, writePositions.data(),
+                                   writeIDs.data());
+      for (auto &vertex : vertices) {
+        // Vector3d force ( Vector3D(counter) + wrap<3,double>(vertex.getCoords()) );
+        Vector3d force(Vector3d::Constant(counter) + vertex.getCoords());
+        for (int dim = 0; dim < 3; dim++)
+          forces[vertex.getID() * 3 + dim] = force[dim];
+        pressures[vertex.getID()] = counter + vertex.getCoords()[0];
+      }
+      cplInterface.writeBlockVectorData(forcesID, size, writeIDs.data(), forces.data());
+      cplInterface.writeBlockScalarData(pressuresID, size, writeIDs.data(), pressures.data());
+
+      cplInterface.getMeshVertices(meshOneID, size, writeIDs.data(),
+                                   getWritePositions.data());
+      BOOST_TEST(writePositions == getWritePositions);
+
+      cplInterface.getMeshVertexIDsFromPositions(meshOneID, size, writePositions.data(),
+                                                 getWriteIDs.data());
+      BOOST_TEST(writeIDs == getWriteIDs);
+      //cplInterface.mapWrittenData(meshID);
+      maxDt = cplInterface.advance(maxDt);
+      if (cplInterface.isCouplingOngoing()) {
+        for (auto &vertex : vertices) {
+          for (int dim = 0; dim < 3; dim++) {
+            int index                 = vertex.getID() * 3 + dim;
+            readPositions[index]      = vertex.getCoords()[dim];
+            expectedVelocities[index] = counter + vertex.getCoords()[dim];
+          }
+          expectedTemperatures[vertex.getID()] = counter + vertex.getCoords()[0];
+        }
+        impl(cplInterface).resetMesh(meshOneID);
+        cplInterface.setMeshVertices(meshOneID, size, readPositions.data(), readIDs.data());
+        cplInterface.mapReadDataTo(meshOneID);
+        cplInterface.readBlockVectorData(velocitiesID, size, readIDs.data(),
+                                         velocities.data());
+        cplInterface.readBlockScalarData(temperaturesID, size, readIDs.data(),
+                                         temperatures.data());
+        BOOST_TEST(velocities == expectedVelocities);
+        BOOST_TEST(temperatures == expectedTemperatures);
+
+        counter += 1.0;
+      }
+    }
+    cplInterface.finalize();
+  } else if (utils::Parallel::getProcessRank() == 1) {
+    SolverInterface cplInterface("SolverTwo", _pathToTests + "explicit-mpi-single-non-inc.xml", 0, 1);
+
+    int squareID       = cplInterface.getMeshID("Test-Square");
+    int forcesID       = cplInterface.getDataID("Forces", squareID);
+    int pressuresID    = cplInterface.getDataID("Pressures", squareID);
+    int velocitiesID   = cplInterface.getDataID("Velocities", squareID);
+    int temperaturesID = cplInterface.getDataID("Temperatures", squareID);
+    cplInterface.setMeshVertex(squareID, Eigen::Vector3d(0.0, 0.0, 0.0).data());
+    cplInterface.setMeshVertex(squareID, Eigen::Vector3d(1.0, 0.0, 0.0).data());
+    cplInterface.setMeshVertex(squareID, Eigen::Vector3d(0.0, 1.0, 0.0).data());
+    cplInterface.setMeshVertex(squareID, Eigen::Vector3d(1.0, 1.0, 0.0).data());
+    double          maxDt    = cplInterface.initialize();
+    const auto &    vertices = impl(cplInterface).mesh("Test-Square").vertices();
+    const int       size     = cplInterface.getMeshVertexSize(squareID);
+    Eigen::VectorXd pressures(size);
+    Eigen::VectorXd temperatures(size);
+
+    // SolverTwo does not start the coupled simulation and has, hence,
+    // already received the first data to be validated.
+    auto validate = [&]() {
+      const double *forces = cplInterface.getReadDataBuffer(forcesID);
+      cplInterface.readAllData(pressuresID, pressures.data());
+      for (auto &vertex : vertices) {
+        BOOST_TEST(Eigen::Map<const Vector3d>(forces + vertex.getID() * 3) == Vector3d::Constant(counter) + vertex.getCoords());
+        BOOST_TEST(pressures[vertex.getID()] == counter + vertex.getCoords()[0]);
+      }
+      counter += 1.0;
+    };
+    validate();
+
+    while (cplInterface.isCouplingOngoing()) {
+      double *velocities = cplInterface.getWriteDataBuffer(velocitiesID);
+      for (auto &vertex : vertices) {
+        Eigen::Map<Vector3d>(velocities + vertex.getID() * 3) = Vector3d::Constant(counter - 1.0) + vertex.getCoords();
+        temperatures[vertex.getID()]                          = counter - 1.0 + vertex.getCoords()[0];
+      }
+      cplInterface.writeAllData(temperaturesID, temperatures.data());
+      maxDt = cplInterface.advance(maxDt);
+      if (cplInterface.isCouplingOngoing()) {
+        validate();
+      }
+    }
+    cplInterface.finalize();
+  }
+}
+
 /**
   * @brief Runs a coupled simulation where one solver supplies a geometry.
   *
@@ -31,17 +31,26 @@ InterpolationElements generateInterpolationElements(
   auto &A = element.vertex(0);
   auto &B = element.vertex(1);
 
-  const auto bcoords = math::barycenter::calcBarycentricCoordsForEdge(
-                           A.getCoords(),
-                           B.getCoords(),
-                           element.getNormal(),
-                           location.getCoords())
-                           .barycentricCoords;
+  // The fixed-size kernels avoid allocations in the hot loop of the projection mapping
+  Eigen::Vector2d bcoords;
+  if (location.getDimensions() == 2) {
+    bcoords = math::barycenter::calcBarycentricCoordsForEdge<2>(
+                  A.getCoords(),
+                  B.getCoords(),
+                  element.getNormal(),
+                  location.getCoords())
+                  .barycentricCoords;
+  } else {
+    PRECICE_ASSERT(location.getDimensions() == 3, location.getDimensions());
+    bcoords = math::barycenter::calcBarycentricCoordsForEdge<3>(
+                  A.getCoords(),
+                  B.getCoords(),
+                  element.getNormal(),
+                  location.getCoords())
+                  .barycentricCoords;
+  }
 
-  InterpolationElements elems;
-  elems.emplace_back(A, bcoords(0));
-  elems.emplace_back(B, bcoords(1));
-  return elems;
+  return {{A, bcoords(0)}, {B, bcoords(1)}};
 }
 
 InterpolationElements generateInterpolationElements(
@@ -52,19 +61,15 @@ InterpolationElements generateInterpolationElements(
   auto &B = element.vertex(1);
   auto &C = element.vertex(2);
 
-  const auto bcoords = math::barycenter::calcBarycentricCoordsForTriangle(
-                           A.getCoords(),
-                           B.getCoords(),
-                           C.getCoords(),
-                           element.getNormal(),
-                           location.getCoords())
-                           .barycentricCoords;
+  const Eigen::Vector3d bcoords = math::barycenter::calcBarycentricCoordsForTriangle<3>(
+                                      A.getCoords(),
+                                      B.getCoords(),
+                                      C.getCoords(),
+                                      element.getNormal(),
+                                      location.getCoords())
+                                      .barycentricCoords;
 
-  InterpolationElements elems;
-  elems.emplace_back(A, bcoords(0));
-  elems.emplace_back(B, bcoords(1));
-  elems.emplace_back(C, bcoords(2));
-  return elems;
+  return {{A, bcoords(0)}, {B, bcoords(1)}, {C, bcoords(2)}};
 }
 
 InterpolationElements generateInterpolationElements(
@@ -1,5 +1,6 @@
 #include "Event.hpp"
 #include "EventUtils.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace utils {
@@ -23,6 +24,17 @@ Event::Event(std::string eventName, bool barrier, bool autostart)
   }
 }
 
+Event::Event(int eventID, bool barrier, bool autostart)
+    : id(eventID),
+      prefixID(EventRegistry::instance().getPrefixID()),
+      _barrier(barrier)
+{
+  PRECICE_ASSERT(id >= 0, "The event was not registered.");
+  if (autostart) {
+    start(_barrier);
+  }
+}
+
 Event::~Event()
 {
   stop(_barrier);
@@ -34,9 +46,10 @@ void Event::start(bool barrier)
     MPI_Barrier(EventRegistry::instance().getMPIComm());
 
   state = State::STARTED;
-  stateChanges.push_back(std::make_pair(State::STARTED, Clock::now()));
+  if (EventRegistry::instance().hasTimeline())
+    stateChanges.push_back(std::make_pair(State::STARTED, Clock::now()));
   starttime = Clock::now();
-  PRECICE_DEBUG("Started event " << name);
+  PRECICE_DEBUG("Started event " << getName());
 }
 
 void Event::stop(bool barrier)
@@ -49,13 +62,14 @@ void Event::stop(bool barrier)
       auto stoptime = Clock::now();
       duration += Clock::duration(stoptime - starttime);
     }
-    stateChanges.push_back(std::make_pair(State::STOPPED, Clock::now()));
+    if (EventRegistry::instance().hasTimeline())
+      stateChanges.push_back(std::make_pair(State::STOPPED, Clock::now()));
     state = State::STOPPED;
     EventRegistry::instance().put(*this);
     data.clear();
     stateChanges.clear();
     duration = Clock::duration::zero();
-    PRECICE_DEBUG("Stopped event " << name);
+    PRECICE_DEBUG("Stopped event " << getName());
   }
 }
 
@@ -66,10 +80,11 @@ void Event::pause(bool barrier)
       MPI_Barrier(EventRegistry::instance().getMPIComm());
 
     auto stoptime = Clock::now();
-    stateChanges.emplace_back(State::PAUSED, Clock::now());
+    if (EventRegistry::instance().hasTimeline())
+      stateChanges.emplace_back(State::PAUSED, Clock::now());
     state = State::PAUSED;
     duration += Clock::duration(stoptime - starttime);
-    PRECICE_DEBUG("Paused event " << name);
+    PRECICE_DEBUG("Paused event " << getName());
   }
 }
 
@@ -83,17 +98,24 @@ void Event::addData(std::string key, int value)
   data[key].push_back(value);
 }
 
+std::string Event::getName() const
+{
+  if (id < 0)
+    return name;
+  return EventRegistry::instance().getEventName(prefixID, id);
+}
+
 // -----------------------------------------------------------------------
 
 ScopedEventPrefix::ScopedEventPrefix(std::string const &name)
 {
   previousName = EventRegistry::instance().prefix;
-  EventRegistry::instance().prefix += name;
+  EventRegistry::instance().setPrefix(previousName + name);
 }
 
 ScopedEventPrefix::~ScopedEventPrefix()
 {
-  EventRegistry::instance().prefix = previousName;
+  EventRegistry::instance().setPrefix(previousName);
 }
 
 } // namespace utils
@@ -41,6 +41,10 @@ public:
   /** Use barrier == true with caution, as it can lead to deadlocks. */
   Event(std::string eventName, bool barrier = false, bool autostart = true);
 
+  /// Creates a new event from an ID returned by EventRegistry::getEventID(), otherwise like the constructor above.
+  /** This avoids building the name of the event and looking it up, whenever the event is created. */
+  Event(int eventID, bool barrier = false, bool autostart = true);
+
   /// Stops the event if it's running and report its times to the EventRegistry
   ~Event();
 
@@ -59,10 +63,19 @@ public:
   /// Adds named integer data, associated to an event.
   void addData(std::string key, int value);
 
+  /// Returns the name of the event including its prefix.
+  std::string getName() const;
+
   Data data;
 
   StateChanges stateChanges;
 
+  /// ID of the event name, -1 if the event was created from a name.
+  int id = -1;
+
+  /// ID of the prefix at creation, only used if id is set.
+  int prefixID = 0;
+
 private:
   logging::Logger _log{"utils::Events"};
 
@@ -76,14 +76,14 @@ EventData::EventData(std::string _name, long _count, long _total, long _max, lon
     : max(std::chrono::milliseconds(_max)),
       min(std::chrono::milliseconds(_min)),
       total(std::chrono::milliseconds(_total)),
-      stateChanges(_stateChanges),
+      stateChanges(_stateChanges.begin(), _stateChanges.end()),
       name(_name),
       count(_count),
       data(data)
 {
 }
 
-void EventData::put(Event const &event)
+void EventData::put(Event const &event, std::size_t timelineCapacity)
 {
   count++;
   stdy_clk::duration duration = event.getDuration();
@@ -95,7 +95,15 @@ void EventData::put(Event const &event)
     auto &target = data[std::get<0>(d)];
     target.insert(target.begin(), source.begin(), source.end());
   }
-  stateChanges.insert(std::end(stateChanges), std::begin(event.stateChanges), std::end(event.stateChanges));
+  for (auto const &sc : event.stateChanges) {
+    // Grow the buffer up to the capacity, afterwards the oldest state changes are overwritten
+    if (stateChanges.capacity() > timelineCapacity)
+      stateChanges.rset_capacity(timelineCapacity);
+    else if (stateChanges.full() && stateChanges.capacity() < timelineCapacity)
+      stateChanges.set_capacity(std::min(timelineCapacity, std::max<std::size_t>(16, 2 * stateChanges.capacity())));
+    if (stateChanges.capacity() > 0)
+      stateChanges.push_back(sc);
+  }
 }
 
 std::string EventData::getName() const
@@ -150,12 +158,17 @@ void RankData::finalize()
 }
 
 void RankData::put(Event const &event)
+{
+  getEventData(event.getName()).put(event);
+}
+
+EventData &RankData::getEventData(std::string const &name)
 {
   /// Construct or return EventData object with name as key and name as arg to ctor.
   auto data = std::get<0>(evData.emplace(std::piecewise_construct,
-                                         std::forward_as_tuple(event.name),
-                                         std::forward_as_tuple(event.name)));
-  data->second.put(event);
+                                         std::forward_as_tuple(name),
+                                         std::forward_as_tuple(name)));
+  return data->second;
 }
 
 void RankData::addEventData(EventData ed)
@@ -239,6 +252,7 @@ void EventRegistry::clear()
   localRankData.clear();
   globalRankData.clear();
   storedEvents.clear();
+  eventDataByID.clear();
 }
 
 void EventRegistry::signal_handler(int signal)
@@ -251,7 +265,58 @@ void EventRegistry::signal_handler(int signal)
 
 void EventRegistry::put(Event const &event)
 {
-  localRankData.put(event);
+  if (event.id < 0) {
+    localRankData.getEventData(event.name).put(event, timelineCapacity);
+    return;
+  }
+
+  if (eventDataByID.size() <= static_cast<size_t>(event.prefixID))
+    eventDataByID.resize(event.prefixID + 1);
+  auto &byID = eventDataByID[event.prefixID];
+  if (byID.size() <= static_cast<size_t>(event.id))
+    byID.resize(event.id + 1, nullptr);
+  if (byID[event.id] == nullptr)
+    byID[event.id] = &localRankData.getEventData(event.getName());
+  byID[event.id]->put(event, timelineCapacity);
+}
+
+int EventRegistry::getEventID(std::string const &name)
+{
+  auto insertion = eventIDs.emplace(name, eventNames.size());
+  if (insertion.second)
+    eventNames.push_back(name);
+  return insertion.first->second;
+}
+
+std::string EventRegistry::getEventName(int prefixID, int eventID) const
+{
+  PRECICE_ASSERT(prefixID >= 0 && static_cast<size_t>(prefixID) < prefixes.size(), prefixID);
+  PRECICE_ASSERT(eventID >= 0 && static_cast<size_t>(eventID) < eventNames.size(), eventID);
+  return prefixes[prefixID] + eventNames[eventID];
+}
+
+void EventRegistry::setPrefix(std::string const &newPrefix)
+{
+  prefix         = newPrefix;
+  auto insertion = prefixIDs.emplace(newPrefix, prefixes.size());
+  if (insertion.second)
+    prefixes.push_back(newPrefix);
+  prefixID = insertion.first->second;
+}
+
+int EventRegistry::getPrefixID() const
+{
+  return prefixID;
+}
+
+void EventRegistry::setTimelineCapacity(std::size_t capacity)
+{
+  timelineCapacity = capacity;
+}
+
+bool EventRegistry::hasTimeline() const
+{
+  return timelineCapacity > 0;
 }
 
 Event &EventRegistry::getStoredEvent(std::string const &name)
@@ -260,12 +325,12 @@ Event &EventRegistry::getStoredEvent(std::string const &name)
   // but leads to unexpected results, such as not getting the event you want, because someone else up the
   // stack set a prefix.
   auto previousPrefix = prefix;
-  prefix              = "";
-  auto insertion      = storedEvents.emplace(std::piecewise_construct,
+  setPrefix("");
+  auto insertion = storedEvents.emplace(std::piecewise_construct,
                                         std::forward_as_tuple(name),
                                         std::forward_as_tuple(name, false, false));
 
-  prefix = previousPrefix;
+  setPrefix(previousPrefix);
   return std::get<0>(insertion)->second;
 }
 
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <boost/circular_buffer.hpp>
 #include <chrono>
+#include <cstddef>
+#include <limits>
 #include <map>
 #include <string>
 #include <vector>
@@ -18,13 +21,16 @@ namespace utils {
 /// Class that aggregates durations for a specific event.
 class EventData {
 public:
+  /// State changes of all events, oldest first
+  using Timeline = boost::circular_buffer<std::pair<Event::State, Event::Clock::time_point>>;
+
   explicit EventData(std::string _name);
 
   EventData(std::string _name, long _count, long _total, long _max, long _min,
             Event::Data data, Event::StateChanges stateChanges);
 
-  /// Adds an Events data.
-  void put(Event const &event);
+  /// Adds an Events data, keeping at most timelineCapacity state changes.
+  void put(Event const &event, std::size_t timelineCapacity = std::numeric_limits<std::size_t>::max());
 
   std::string getName() const;
 
@@ -49,7 +55,7 @@ public:
   Event::Clock::duration min   = Event::Clock::duration::max();
   Event::Clock::duration total = Event::Clock::duration::zero();
 
-  Event::StateChanges stateChanges;
+  Timeline stateChanges;
 
 private:
   std::string                             name;
@@ -69,6 +75,9 @@ public:
   /// Adds a new event
   void put(Event const &event);
 
+  /// Returns the EventData of the given name, which is created if it does not exist.
+  EventData &getEventData(std::string const &name);
+
   /// Adds aggregated data for a specific event
   void addEventData(EventData ed);
 
@@ -136,6 +145,29 @@ public:
   /// Records the event.
   void put(Event const &event);
 
+  /// Returns the ID of an event name, which is registered on first use.
+  /**
+   * Events created from an ID only look up their EventData once per prefix.
+   * Register names with varying parts, such as mesh names, once at construction
+   * of the owning object instead of building them for every event.
+   */
+  int getEventID(std::string const &name);
+
+  /// Returns the name of a registered event with a registered prefix
+  std::string getEventName(int prefixID, int eventID) const;
+
+  /// Sets the currently active prefix, see ScopedEventPrefix
+  void setPrefix(std::string const &newPrefix);
+
+  /// Returns the ID of the currently active prefix
+  int getPrefixID() const;
+
+  /// Limits the state changes kept per event name to the latest capacity ones, 0 disables the timeline.
+  void setTimelineCapacity(std::size_t capacity);
+
+  /// Returns true, if events record their state changes
+  bool hasTimeline() const;
+
   /// Returns or creates a stored event, i.e., an event with life beyond the current scope
   Event &getStoredEvent(std::string const &name);
 
@@ -150,7 +182,7 @@ public:
 
   MPI_Comm const &getMPIComm() const;
 
-  /// Currently active prefix. Changing that applies only to newly created events.
+  /// Currently active prefix. Changing that by setPrefix() applies only to newly created events.
   std::string prefix;
 
   /// A name that is added to the logfile to identify a run
@@ -192,6 +224,27 @@ private:
 
   std::map<std::string, Event> storedEvents;
 
+  /// Registered event names, indexed by their ID
+  std::vector<std::string> eventNames;
+
+  /// IDs of the registered event names
+  std::map<std::string, int> eventIDs;
+
+  /// Registered prefixes, indexed by their ID. The empty prefix has the ID 0.
+  std::vector<std::string> prefixes{""};
+
+  /// IDs of the registered prefixes
+  std::map<std::string, int> prefixIDs{{"", 0}};
+
+  /// ID of the currently active prefix
+  int prefixID = 0;
+
+  /// EventData of localRankData of events created from an ID, indexed by prefix ID and event ID
+  std::vector<std::vector<EventData *>> eventDataByID;
+
+  /// Maximum amount of state changes kept per event name
+  std::size_t timelineCapacity = std::numeric_limits<std::size_t>::max();
+
   /// A name that is added to the logfile to distinguish different participants
   std::string applicationName;
 
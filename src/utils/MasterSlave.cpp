@@ -2,7 +2,10 @@
 
 #include "MasterSlave.hpp"
 
+#include <algorithm>
 #include "com/Communication.hpp"
+#include "com/MPICommunication.hpp"
+#include "utils/Parallel.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -16,6 +19,24 @@ com::PtrCommunication MasterSlave::_communication;
 
 logging::Logger MasterSlave::_log("utils::MasterSlave");
 
+namespace {
+
+#ifndef PRECICE_NO_MPI
+/**
+ * @brief Returns true, if reductions can use MPI collectives directly.
+ *
+ * This is the case if the master-slave communication is MPI-based and the
+ * global communicator consists of the ranks of the participant only.
+ */
+bool useMPICollectives()
+{
+  return std::dynamic_pointer_cast<com::MPICommunication>(MasterSlave::_communication) != nullptr &&
+         Parallel::getCommunicatorSize() == MasterSlave::getSize();
+}
+#endif // not PRECICE_NO_MPI
+
+} // namespace
+
 void MasterSlave::configure(int rank, int size)
 {
   PRECICE_TRACE(rank, size);
@@ -184,12 +205,20 @@ void MasterSlave::allreduceSum(double *sendData, double *rcvData, int size)
   PRECICE_TRACE();
 
   if (not _isMaster && not _isSlave) {
+    std::copy(sendData, sendData + size, rcvData);
     return;
   }
 
   PRECICE_ASSERT(_communication.get() != nullptr);
   PRECICE_ASSERT(_communication->isConnected());
 
+#ifndef PRECICE_NO_MPI
+  if (useMPICollectives()) {
+    MPI_Allreduce(sendData, rcvData, size, MPI_DOUBLE, MPI_SUM, Parallel::getGlobalCommunicator());
+    return;
+  }
+#endif // not PRECICE_NO_MPI
+
   if (_isSlave) {
     // send local result to master, receive reduced result from master
     _communication->allreduceSum(sendData, rcvData, size, 0);
@@ -206,12 +235,20 @@ void MasterSlave::allreduceSum(double &sendData, double &rcvData, int size)
   PRECICE_TRACE();
 
   if (not _isMaster && not _isSlave) {
+    rcvData = sendData;
     return;
   }
 
   PRECICE_ASSERT(_communication.get() != nullptr);
   PRECICE_ASSERT(_communication->isConnected());
 
+#ifndef PRECICE_NO_MPI
+  if (useMPICollectives()) {
+    MPI_Allreduce(&sendData, &rcvData, 1, MPI_DOUBLE, MPI_SUM, Parallel::getGlobalCommunicator());
+    return;
+  }
+#endif // not PRECICE_NO_MPI
+
   if (_isSlave) {
     // send local result to master, receive reduced result from master
     _communication->allreduceSum(sendData, rcvData, 0);
@@ -228,12 +265,20 @@ void MasterSlave::allreduceSum(int &sendData, int &rcvData, int size)
   PRECICE_TRACE();
 
   if (not _isMaster && not _isSlave) {
+    rcvData = sendData;
     return;
   }
 
   PRECICE_ASSERT(_communication.get() != nullptr);
   PRECICE_ASSERT(_communication->isConnected());
 
+#ifndef PRECICE_NO_MPI
+  if (useMPICollectives()) {
+    MPI_Allreduce(&sendData, &rcvData, 1, MPI_INT, MPI_SUM, Parallel::getGlobalCommunicator());
+    return;
+  }
+#endif // not PRECICE_NO_MPI
+
   if (_isSlave) {
     // send local result to master, receive reduced result from master
     _communication->allreduceSum(sendData, rcvData, 0);
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/// Returns the amount of threads to use, where 0 requests one thread per hardware thread.
+inline int resolveThreadCount(int requested)
+{
+  if (requested > 0) {
+    return requested;
+  }
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Calls function(begin, end) for contiguous chunks of the range [0, size) on up to threads threads.
+ *
+ * The calling thread processes the first chunk and returns when all chunks are
+ * processed. The function has to be safe to call concurrently for disjoint ranges.
+ * With threads <= 1, function(0, size) is called directly.
+ */
+template <typename Function>
+void parallelFor(std::size_t size, int threads, Function function)
+{
+  const std::size_t chunks = std::min<std::size_t>(std::max(threads, 1), size);
+  if (chunks <= 1) {
+    if (size > 0) {
+      function(std::size_t(0), size);
+    }
+    return;
+  }
+
+  const std::size_t        chunkSize = (size + chunks - 1) / chunks;
+  std::vector<std::thread> workers;
+  workers.reserve(chunks - 1);
+  for (std::size_t begin = chunkSize; begin < size; begin += chunkSize) {
+    workers.emplace_back(function, begin, std::min(size, begin + chunkSize));
+  }
+  function(std::size_t(0), chunkSize);
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+}
+
+} // namespace utils
+} // namespace precice
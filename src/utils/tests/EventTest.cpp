@@ -0,0 +1,63 @@
+#include "testing/Testing.hpp"
+#include "utils/Event.hpp"
+#include "utils/EventUtils.hpp"
+
+using namespace precice;
+using namespace precice::utils;
+
+namespace {
+
+/// Removes the events recorded by a test from the global registry
+struct EventRegistryFixture {
+  ~EventRegistryFixture()
+  {
+    EventRegistry::instance().clear();
+  }
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_FIXTURE_TEST_SUITE(EventTests, EventRegistryFixture, *testing::OnMaster())
+
+BOOST_AUTO_TEST_CASE(RegisteredEvents)
+{
+  auto &    registry = EventRegistry::instance();
+  const int id       = registry.getEventID("test.registered");
+  BOOST_TEST(registry.getEventID("test.registered") == id);
+  BOOST_TEST(registry.getEventID("test.other") != id);
+
+  {
+    ScopedEventPrefix sep("scope/");
+    Event             e(id);
+    BOOST_TEST(e.getName() == "scope/test.registered");
+  }
+  Event e(id, false, false);
+  BOOST_TEST(e.getName() == "test.registered");
+}
+
+BOOST_AUTO_TEST_CASE(BoundedTimeline)
+{
+  Event     event("test.timeline", false, false);
+  EventData data("test.timeline");
+  for (int i = 0; i < 10; ++i) {
+    event.stateChanges.emplace_back(Event::State::STARTED, Event::Clock::time_point(std::chrono::milliseconds(2 * i)));
+    event.stateChanges.emplace_back(Event::State::STOPPED, Event::Clock::time_point(std::chrono::milliseconds(2 * i + 1)));
+    data.put(event, 5);
+    event.stateChanges.clear();
+  }
+  BOOST_TEST(data.getCount() == 10);
+  BOOST_TEST(data.stateChanges.size() == 5);
+  // Only the latest state changes are kept
+  BOOST_TEST((data.stateChanges.back().second == Event::Clock::time_point(std::chrono::milliseconds(19))));
+  BOOST_TEST((data.stateChanges.front().second == Event::Clock::time_point(std::chrono::milliseconds(15))));
+
+  EventData withoutTimeline("test.timeline");
+  event.stateChanges.emplace_back(Event::State::STOPPED, Event::Clock::now());
+  withoutTimeline.put(event, 0);
+  BOOST_TEST(withoutTimeline.getCount() == 1);
+  BOOST_TEST(withoutTimeline.stateChanges.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()